@@ -18,6 +18,10 @@ let package = Package(
             name: "OscillatorsCpp",
             targets: ["OscillatorsCpp"]
         ),
+        .executable(
+            name: "OscillatorsAnalyzer",
+            targets: ["OscillatorsAnalyzer"]
+        ),
     ],
     dependencies: [
         // Dependencies declare other packages that this package depends on.
@@ -33,6 +37,11 @@ let package = Package(
         .target(name: "OscillatorsCpp",
             cxxSettings: [.headerSearchPath(".")]
         ),
+        .executableTarget(
+            name: "OscillatorsAnalyzer",
+            dependencies: ["OscillatorsCpp"],
+            cxxSettings: [.headerSearchPath("../OscillatorsCpp")]
+        ),
         .testTarget(
             name: "OscillatorsTests",
             dependencies: ["Oscillators", "OscillatorsCpp"]
@@ -0,0 +1,287 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Command-line spectrogram analyzer: streams a WAV or raw PCM file, memory-mapped, through a ResonatorBankVec
+// in hops of samples, reading one channel in place (sample stride), and writes the powers (or amplitudes)
+// of the resonators after each hop, as raw float32 rows or in a compact spectrogram file (see Spectrogram.hpp).
+// Memory use does not depend on the length of the input.
+
+#include "MappedFile.hpp"
+#include "PCM.hpp"
+#include "ResonatorBankVec.hpp"
+#include "Spectrogram.hpp"
+#include "Wav.hpp"
+
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace oscillators_cpp;
+
+namespace {
+
+struct Options {
+    std::string inputPath;
+    std::string outputPath;
+    /// Raw input: sample format ("int16", "int24", "int32" or "float32"; empty for WAV input)
+    std::string rawFormat;
+    float rawSampleRate = 44100.0f;
+    size_t rawNumChannels = 1;
+    size_t rawOffset = 0;
+    size_t channel = 0;
+    size_t hop = 512;
+    /// Log-uniform frequencies (as Frequencies.logUniformFrequencies)
+    float minFrequency = 32.70f;
+    size_t numBins = 84;
+    size_t numBinsPerOctave = 12;
+    /// Time constant of the resonators in seconds (alpha = beta)
+    float timeConstant = 0.1f;
+    bool amplitudes = false;
+    /// Output format: "float32" (raw rows), "float16" or "log8" (spectrogram file)
+    std::string format = "float32";
+    float dynamicRange = 96.0f;
+    size_t chunkFrames = 256;
+};
+
+void printUsage() {
+    fprintf(stderr,
+            "usage: OscillatorsAnalyzer [options] input output\n"
+            "  input: WAV file (16, 24, 32-bit integer or 32-bit float samples, RIFF or RF64), or raw samples with --raw\n"
+            "  output: one row of <bins> powers per hop, as float32 values (native byte order) or in a spectrogram file\n"
+            "options:\n"
+            "  --raw <int16|int24|int32|float32>  raw input sample format (little-endian, interleaved channels)\n"
+            "  --rate <Hz>                        raw input sample rate (44100)\n"
+            "  --channels <n>                     raw input number of channels (1)\n"
+            "  --offset <bytes>                   raw input offset of the first sample (0)\n"
+            "  --channel <index>                  channel to analyze (0)\n"
+            "  --hop <samples>                    samples per output row (512)\n"
+            "  --min-frequency <Hz>               frequency of the first resonator (32.70)\n"
+            "  --bins <n>                         number of resonators (84)\n"
+            "  --bins-per-octave <n>              resonators per octave (12)\n"
+            "  --time-constant <s>                time constant of the resonators (0.1)\n"
+            "  --amplitudes                       write amplitudes instead of powers\n"
+            "  --format <float32|float16|log8>    output format (float32)\n"
+            "  --dynamic-range <dB>               log8 dynamic range (96)\n"
+            "  --chunk-frames <n>                 spectrogram frames per chunk (256)\n");
+}
+
+Options parseOptions(int argc, char *argv[]) {
+    Options options;
+    std::vector<std::string> paths;
+    for (int i=1; i<argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> std::string {
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("Missing value for " + arg);
+            }
+            return argv[++i];
+        };
+        if (arg == "--raw") {
+            options.rawFormat = value();
+        } else if (arg == "--rate") {
+            options.rawSampleRate = std::stof(value());
+        } else if (arg == "--channels") {
+            options.rawNumChannels = std::stoul(value());
+        } else if (arg == "--offset") {
+            options.rawOffset = std::stoull(value());
+        } else if (arg == "--channel") {
+            options.channel = std::stoul(value());
+        } else if (arg == "--hop") {
+            options.hop = std::stoul(value());
+        } else if (arg == "--min-frequency") {
+            options.minFrequency = std::stof(value());
+        } else if (arg == "--bins") {
+            options.numBins = std::stoul(value());
+        } else if (arg == "--bins-per-octave") {
+            options.numBinsPerOctave = std::stoul(value());
+        } else if (arg == "--time-constant") {
+            options.timeConstant = std::stof(value());
+        } else if (arg == "--amplitudes") {
+            options.amplitudes = true;
+        } else if (arg == "--format") {
+            options.format = value();
+        } else if (arg == "--dynamic-range") {
+            options.dynamicRange = std::stof(value());
+        } else if (arg == "--chunk-frames") {
+            options.chunkFrames = std::stoul(value());
+        } else if (arg.size() > 1 && arg[0] == '-') {
+            throw std::invalid_argument("Unknown option " + arg);
+        } else {
+            paths.push_back(arg);
+        }
+    }
+    if (paths.size() != 2) {
+        throw std::invalid_argument("Expected an input and an output path");
+    }
+    options.inputPath = paths[0];
+    options.outputPath = paths[1];
+    if (options.hop == 0 || options.numBins == 0 || options.numBinsPerOctave == 0 || !(options.timeConstant > 0.0f)) {
+        throw std::invalid_argument("Bad hop, bins or time constant");
+    }
+    if (options.format != "float32" && options.format != "float16" && options.format != "log8") {
+        throw std::invalid_argument("Unknown output format " + options.format);
+    }
+    return options;
+}
+
+/// Layout of the input samples, in the WAV header or from the raw input options
+WavInfo inputLayout(const Options &options, const MappedFile &file) {
+    if (options.rawFormat.empty()) {
+        return parseWav(file.data(), file.size());
+    }
+    WavInfo info = {};
+    info.numChannels = options.rawNumChannels;
+    info.sampleRate = options.rawSampleRate;
+    if (options.rawFormat == "float32") {
+        info.isFloat = true;
+        info.sampleSize = sizeof(float);
+    } else if (options.rawFormat == "int16" || options.rawFormat == "int24" || options.rawFormat == "int32") {
+        info.pcmFormat = options.rawFormat == "int16" ? PCMFormat::Int16 : options.rawFormat == "int24" ? PCMFormat::Int24 : PCMFormat::Int32;
+        info.sampleSize = pcmSampleSize(info.pcmFormat);
+    } else {
+        throw std::invalid_argument("Unknown raw sample format " + options.rawFormat);
+    }
+    if (info.numChannels == 0 || !(info.sampleRate > 0.0f) || options.rawOffset > file.size()) {
+        throw std::invalid_argument("Bad raw input layout");
+    }
+    info.dataOffset = options.rawOffset;
+    info.numFrames = (file.size() - options.rawOffset) / (info.sampleSize * info.numChannels);
+    return info;
+}
+
+void analyze(const Options &options) {
+    MappedFile file(options.inputPath, MappedFile::Access::Sequential);
+    const WavInfo input = inputLayout(options, file);
+    if (options.channel >= input.numChannels) {
+        throw std::invalid_argument("Bad channel");
+    }
+
+    const size_t n = options.numBins;
+    std::vector<float> frequencies(n);
+    for (size_t k=0; k<n; ++k) {
+        frequencies[k] = options.minFrequency * std::pow(2.0f, static_cast<float>(k) / static_cast<float>(options.numBinsPerOctave));
+    }
+    const float alpha = 1.0f - std::exp(-1.0f / (input.sampleRate * options.timeConstant));
+    const std::vector<float> alphas(n, alpha);
+    ResonatorBankVec bank(n, frequencies, alphas, alphas, input.sampleRate);
+
+    // raw float32 rows, or a spectrogram file
+    std::unique_ptr<FILE, int(*)(FILE*)> output(nullptr, fclose);
+    std::unique_ptr<SpectrogramWriter> spectrogram;
+    if (options.format == "float32") {
+        output.reset(fopen(options.outputPath.c_str(), "wb"));
+        if (!output) {
+            throw std::runtime_error("Cannot open " + options.outputPath + ": " + strerror(errno));
+        }
+        setvbuf(output.get(), nullptr, _IOFBF, size_t(1) << 20);
+    } else {
+        SpectrogramInfo info;
+        info.frequencies = frequencies;
+        info.alphas = alphas;
+        info.betas = alphas;
+        info.sampleRate = input.sampleRate;
+        info.hop = options.hop;
+        info.encoding = options.format == "float16" ? SpectrogramEncoding::Float16 : SpectrogramEncoding::Log8;
+        info.dynamicRange = options.dynamicRange;
+        info.framesPerChunk = options.chunkFrames;
+        spectrogram.reset(new SpectrogramWriter(options.outputPath, info));
+    }
+
+    // the samples of the channel are read in place, every numChannels samples
+    const size_t stride = input.numChannels;
+    const size_t hop = options.hop;
+    const uint8_t *samples = file.data() + input.dataOffset + options.channel * input.sampleSize;
+    const bool alignedFloats = input.isFloat && reinterpret_cast<uintptr_t>(samples) % alignof(float) == 0;
+    std::vector<float> hopSamples(input.isFloat && !alignedFloats ? hop : 0);
+    std::vector<float> row(n);
+    size_t numRows = 0;
+    // the pages read are released regularly (they stay in the page cache)
+    constexpr size_t releaseInterval = size_t(64) << 20;
+    size_t released = 0;
+    for (size_t first = 0; first < input.numFrames; first += hop) {
+        const size_t count = std::min(hop, input.numFrames - first);
+        const uint8_t *data = samples + first * stride * input.sampleSize;
+        const size_t frameLength = (count - 1) * stride + 1;
+        if (alignedFloats) {
+            bank.update(reinterpret_cast<const float*>(data), frameLength, stride);
+        } else if (input.isFloat) {
+            for (size_t i=0; i<count; ++i) {
+                memcpy(&hopSamples[i], data + i * stride * sizeof(float), sizeof(float));
+            }
+            bank.update(hopSamples.data(), count, 1);
+        } else {
+            bank.update(data, input.pcmFormat, frameLength, stride, pcmFullScale(input.pcmFormat));
+        }
+        if (count < hop) {
+            break; // no output for a trailing partial hop
+        }
+        if (options.amplitudes) {
+            bank.getAmplitudes(row.data(), n);
+        } else {
+            bank.getPowers(row.data(), n);
+        }
+        if (spectrogram) {
+            spectrogram->append(row.data(), 1);
+        } else if (fwrite(row.data(), sizeof(float), n, output.get()) != n) {
+            throw std::runtime_error("Cannot write " + options.outputPath);
+        }
+        ++numRows;
+        const size_t position = static_cast<size_t>(data - file.data());
+        if (position - released >= releaseInterval) {
+            file.release(position);
+            released = position;
+        }
+    }
+    if (spectrogram) {
+        spectrogram->close();
+    } else if (fflush(output.get()) != 0) {
+        throw std::runtime_error("Cannot write " + options.outputPath);
+    }
+    fprintf(stderr, "%zu frames at %g Hz, %zu rows of %zu values (hop %zu)\n",
+            input.numFrames, input.sampleRate, numRows, n, hop);
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    try {
+        analyze(parseOptions(argc, argv));
+    } catch (const std::invalid_argument &error) {
+        fprintf(stderr, "%s\n", error.what());
+        printUsage();
+        return EXIT_FAILURE;
+    } catch (const std::exception &error) {
+        fprintf(stderr, "%s\n", error.what());
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
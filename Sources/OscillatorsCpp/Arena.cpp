@@ -0,0 +1,71 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "Arena.hpp"
+
+#include <cstdint>
+
+using namespace oscillators_cpp;
+
+Arena::Arena(size_t capacity)
+: m_block(nullptr), m_capacity(Arena::alignedSize(capacity)), m_used(0), m_numOverflows(0), m_owned(true) {
+    if (m_capacity > 0) {
+        m_block = static_cast<char *>(::operator new(m_capacity, std::align_val_t(arenaAlignment)));
+    }
+}
+
+Arena::Arena(void *block, size_t size) noexcept
+: m_block(nullptr), m_capacity(0), m_used(0), m_numOverflows(0), m_owned(false) {
+    if (!block) {
+        return;
+    }
+    const uintptr_t address = reinterpret_cast<uintptr_t>(block);
+    const size_t offset = (arenaAlignment - address % arenaAlignment) % arenaAlignment;
+    if (offset < size) {
+        m_block = static_cast<char *>(block) + offset;
+        m_capacity = (size - offset) / arenaAlignment * arenaAlignment;
+    }
+}
+
+Arena::~Arena() {
+    if (m_owned && m_block) {
+        ::operator delete(m_block, std::align_val_t(arenaAlignment));
+    }
+}
+
+void *Arena::allocate(size_t size) noexcept {
+    const size_t alignedSize = Arena::alignedSize(size);
+    if (alignedSize > m_capacity - m_used) {
+        ++m_numOverflows;
+        return nullptr;
+    }
+    void *p = m_block + m_used;
+    m_used += alignedSize;
+    return p;
+}
+
+bool Arena::owns(const void *pointer) const noexcept {
+    const char *p = static_cast<const char *>(pointer);
+    return m_block && p >= m_block && p < m_block + m_capacity;
+}
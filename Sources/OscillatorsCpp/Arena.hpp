@@ -0,0 +1,124 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef Arena_hpp
+#define Arena_hpp
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace oscillators_cpp {
+
+/// Alignment of arenas and of each of their allocations: a cache line, and the widest SIMD vector (AVX-512)
+constexpr size_t arenaAlignment = 64;
+
+/// Single 64-byte aligned block of memory from which buffers are carved in sequence (bump allocation),
+/// so that an object's buffers lie in one contiguous block, and can be set up and released without calling
+/// the system allocator (real-time safe).
+/// The block is either supplied by the caller, or allocated once by the arena.
+/// Allocations are only released all at once, with the arena, which must outlive the objects using it.
+/// Not thread safe.
+class Arena {
+public:
+    Arena & operator=(const Arena&) = delete;
+    Arena(const Arena&) = delete;
+
+    /// Arena over a block of capacity bytes, allocated once (no block if capacity is 0)
+    explicit Arena(size_t capacity = 0);
+    /// Arena over a caller-supplied block (not owned), from its first aligned address
+    Arena(void *block, size_t size) noexcept;
+    ~Arena();
+
+    /// Space taken by an allocation of size bytes
+    static constexpr size_t alignedSize(size_t size) noexcept {
+        return (size + arenaAlignment - 1) / arenaAlignment * arenaAlignment;
+    }
+
+    size_t capacity() const noexcept { return m_capacity; }
+    size_t used() const noexcept { return m_used; }
+    /// Number of allocations that did not fit (see ArenaAllocator)
+    size_t numOverflows() const noexcept { return m_numOverflows; }
+
+    /// Aligned buffer of size bytes, or null if there is not enough space left
+    void *allocate(size_t size) noexcept;
+    /// Whether pointer is in the arena's block
+    bool owns(const void *pointer) const noexcept;
+
+private:
+    char *m_block;
+    size_t m_capacity;
+    size_t m_used;
+    size_t m_numOverflows;
+    bool m_owned;
+};
+
+/// Allocator for standard containers, allocating from an arena, or from the heap (64-byte aligned)
+/// if the arena is null or full. Deallocating memory from the arena is a no-op.
+template <typename T>
+class ArenaAllocator {
+public:
+    typedef T value_type;
+
+    ArenaAllocator(Arena *arena = nullptr) noexcept : m_arena(arena) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> &other) noexcept : m_arena(other.arena()) {}
+
+    Arena *arena() const noexcept { return m_arena; }
+
+    /// Copies of containers are allocated from the heap
+    ArenaAllocator select_on_container_copy_construction() const noexcept { return ArenaAllocator(); }
+
+    T *allocate(size_t n) {
+        if (m_arena) {
+            if (void *p = m_arena->allocate(n * sizeof(T))) {
+                return static_cast<T *>(p);
+            }
+        }
+        return static_cast<T *>(::operator new(Arena::alignedSize(n * sizeof(T)), std::align_val_t(arenaAlignment)));
+    }
+
+    void deallocate(T *p, size_t) noexcept {
+        if (m_arena && m_arena->owns(p)) {
+            return;
+        }
+        ::operator delete(p, std::align_val_t(arenaAlignment));
+    }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U> &other) const noexcept { return m_arena == other.arena(); }
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U> &other) const noexcept { return m_arena != other.arena(); }
+
+private:
+    Arena *m_arena;
+};
+
+/// Vector with 64-byte aligned storage, optionally allocated from an arena
+template <typename T>
+using AlignedVector = std::vector<T, ArenaAllocator<T>>;
+
+} // oscillators_cpp
+
+#endif /* Arena_hpp */
@@ -0,0 +1,51 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "Checkpoint.hpp"
+#include "VectorOps.hpp"
+
+#include <stdexcept>
+
+using namespace oscillators_cpp;
+
+CheckpointHeader oscillators_cpp::readCheckpointHeader(const void *data, size_t size, CheckpointType type) {
+    CheckpointHeader header;
+    if (!data || size < sizeof(header)) {
+        OSCILLATORS_THROW(std::invalid_argument("Checkpoint too short"));
+    }
+    memcpy(&header, data, sizeof(header));
+    if (header.magic != checkpointMagic) {
+        OSCILLATORS_THROW(std::invalid_argument("Not a checkpoint"));
+    }
+    if (header.version != checkpointVersion) {
+        OSCILLATORS_THROW(std::invalid_argument("Unsupported checkpoint version"));
+    }
+    if (header.type != static_cast<uint16_t>(type)) {
+        OSCILLATORS_THROW(std::invalid_argument("Wrong checkpoint type"));
+    }
+    if (header.size > size) {
+        OSCILLATORS_THROW(std::invalid_argument("Truncated checkpoint"));
+    }
+    return header;
+}
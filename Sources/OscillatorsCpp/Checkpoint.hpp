@@ -0,0 +1,123 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef Checkpoint_hpp
+#define Checkpoint_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace oscillators_cpp {
+
+/// Checkpoints: the configuration and state of a Resonator, ResonatorBank or ResonatorBankVec as a compact binary blob,
+/// so that a stream can resume on another worker without waiting for its resonators to settle.
+/// A blob is a CheckpointHeader followed by the raw arrays of the object (native byte order, no padding).
+constexpr uint32_t checkpointMagic = 0x4b43534f; // "OSCK"
+/// Incremented when the layout of any blob changes
+constexpr uint16_t checkpointVersion = 2;
+
+enum class CheckpointType : uint16_t {
+    Resonator = 1,
+    ResonatorBank = 2,
+    ResonatorBankVec = 3
+};
+
+struct CheckpointHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t type;
+    /// Size of the blob in bytes, header included
+    uint64_t size;
+    uint64_t numResonators;
+    float sampleRate;
+    /// Precision of the object: sizeof(Real) and sizeof(PhasorReal) (4 or 8, e.g. 4 and 8 for a mixed precision bank)
+    uint8_t realSize;
+    uint8_t phasorRealSize;
+    uint16_t reserved;
+};
+
+/// Header of a checkpoint of the given type, checked against the size of the blob
+CheckpointHeader readCheckpointHeader(const void *data, size_t size, CheckpointType type);
+
+/// Whether a checkpoint was saved by an object in the precisions Real and PhasorReal
+/// (checked by the callers of readCheckpointHeader(), which reject the other precisions)
+template <typename Real, typename PhasorReal = Real>
+bool checkpointPrecisionMatches(const CheckpointHeader &header) {
+    return header.realSize == sizeof(Real) && header.phasorRealSize == sizeof(PhasorReal);
+}
+
+/// Sequential writes to a checkpoint blob (the caller checks the size beforehand)
+class CheckpointWriter {
+public:
+    CheckpointWriter(void *data, const CheckpointHeader &header) : m_data(static_cast<uint8_t*>(data)), m_offset(0) {
+        write(&header, 1);
+    }
+
+    template <typename T>
+    void write(const T *values, size_t count) {
+        memcpy(m_data + m_offset, values, count * sizeof(T));
+        m_offset += count * sizeof(T);
+    }
+    template <typename T>
+    void write(const T &value) { write(&value, 1); }
+
+    size_t offset() const { return m_offset; }
+
+private:
+    uint8_t *m_data;
+    size_t m_offset;
+};
+
+/// Sequential reads from a checkpoint blob, after its header (the size was checked by readCheckpointHeader())
+class CheckpointReader {
+public:
+    explicit CheckpointReader(const void *data) : m_data(static_cast<const uint8_t*>(data)), m_offset(sizeof(CheckpointHeader)) {}
+
+    template <typename T>
+    void read(T *values, size_t count) {
+        memcpy(values, m_data + m_offset, count * sizeof(T));
+        m_offset += count * sizeof(T);
+    }
+    template <typename T>
+    T read() {
+        T value;
+        read(&value, 1);
+        return value;
+    }
+    /// Values in place, for comparisons, skipped
+    const uint8_t *skip(size_t numBytes) {
+        const uint8_t *values = m_data + m_offset;
+        m_offset += numBytes;
+        return values;
+    }
+
+private:
+    const uint8_t *m_data;
+    size_t m_offset;
+};
+
+} // oscillators_cpp
+
+#endif /* Checkpoint_hpp */
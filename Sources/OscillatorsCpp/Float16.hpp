@@ -0,0 +1,101 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef Float16_hpp
+#define Float16_hpp
+
+#include <cstdint>
+#include <cstring>
+
+namespace oscillators_cpp {
+
+/// 16-bit floating point formats, for compact storage of values that are widened to float for the arithmetic.
+
+/// IEEE 754 half precision (binary16) conversions, portable (no compiler or hardware half type needed).
+/// Conversions from float round to nearest even; values beyond the half range become infinities.
+inline uint16_t floatToHalf(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    const uint32_t sign = bits & 0x80000000u;
+    bits ^= sign;
+    uint32_t half;
+    if (bits >= 0x47800000u) {
+        // 65536 and above, infinities and NaNs (65520 and above round to infinity below)
+        half = bits > 0x7f800000u ? 0x7e00u : 0x7c00u;
+    } else if (bits < 0x38800000u) {
+        // subnormal half (or zero): the float addition rounds the mantissa
+        float magnitude;
+        memcpy(&magnitude, &bits, sizeof(magnitude));
+        magnitude += 0.5f;
+        uint32_t rounded;
+        memcpy(&rounded, &magnitude, sizeof(rounded));
+        half = rounded - 0x3f000000u;
+    } else {
+        // rebias the exponent and round the mantissa to 10 bits, to nearest even
+        const uint32_t odd = (bits >> 13) & 1u;
+        bits += 0xc8000fffu + odd;
+        half = bits >> 13;
+    }
+    return static_cast<uint16_t>(half | (sign >> 16));
+}
+
+/// Branch-free, so that loops of conversions vectorize
+inline float halfToFloat(uint16_t half) {
+    // exponent and mantissa moved to their float positions, then the exponent rebiased by a multiplication by 2^112
+    // (exact, subnormal halves included)
+    const uint32_t magnitude = static_cast<uint32_t>(half & 0x7fffu) << 13;
+    float value;
+    memcpy(&value, &magnitude, sizeof(value));
+    value *= 5.192296858534828e+33f;
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    // infinities and NaNs
+    bits |= 0x7f800000u & (0u - static_cast<uint32_t>(magnitude >= 0x0f800000u));
+    bits |= static_cast<uint32_t>(half & 0x8000u) << 16;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/// bfloat16 (the upper half of a float: 8-bit exponent, 7-bit mantissa) conversions.
+/// Conversions from float round to nearest even (NaNs stay NaNs).
+inline uint16_t floatToBFloat16(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    if ((bits & 0x7fffffffu) > 0x7f800000u) {
+        return static_cast<uint16_t>((bits >> 16) | 0x40u);
+    }
+    bits += 0x7fffu + ((bits >> 16) & 1u);
+    return static_cast<uint16_t>(bits >> 16);
+}
+
+inline float bfloat16ToFloat(uint16_t value) {
+    const uint32_t bits = static_cast<uint32_t>(value) << 16;
+    float result;
+    memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+} // oscillators_cpp
+
+#endif /* Float16_hpp */
@@ -0,0 +1,123 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "HalfBandDecimator.hpp"
+#include "VectorOps.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+using namespace oscillators_cpp;
+
+namespace {
+
+/// Modified Bessel function of the first kind, order 0 (for the Kaiser window)
+double besselI0(double x) {
+    double sum = 1.0;
+    double term = 1.0;
+    for (int k=1; k<50; ++k) {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum += term;
+        if (term < sum * 1e-12) {
+            break;
+        }
+    }
+    return sum;
+}
+
+} // namespace
+
+HalfBandDecimator::HalfBandDecimator(size_t numTaps) {
+    // a half-band filter has 4k - 1 taps, so that the first and last taps are odd
+    if (numTaps < 3 || (numTaps + 1) % 4 != 0) {
+        throw std::invalid_argument("Bad number of taps passed to HalfBandDecimator(): must be 4k - 1");
+    }
+    m_halfLength = (numTaps - 1) / 2;
+
+    // Kaiser windowed sinc, cutoff at a quarter of the input sample rate
+    constexpr double pi = 3.14159265358979323846;
+    constexpr double kaiserBeta = 7.86; // about 80 dB stopband attenuation
+    const double i0Beta = besselI0(kaiserBeta);
+    m_oddTaps.resize((m_halfLength + 1) / 2);
+    double sum = 0.5;
+    for (size_t j=0; j<m_oddTaps.size(); ++j) {
+        const double n = static_cast<double>(2 * j + 1);
+        const double sinc = std::sin(pi * n / 2.0) / (pi * n);
+        const double ratio = n / static_cast<double>(m_halfLength);
+        const double window = besselI0(kaiserBeta * std::sqrt(1.0 - ratio * ratio)) / i0Beta;
+        m_oddTaps[j] = static_cast<float>(sinc * window);
+        sum += 2.0 * sinc * window;
+    }
+    // unit gain at DC
+    for (float &tap : m_oddTaps) {
+        tap = static_cast<float>(tap / sum);
+    }
+    m_centerTap = static_cast<float>(0.5 / sum);
+
+    reset();
+}
+
+void HalfBandDecimator::reset() {
+    m_buffer.assign(2 * m_halfLength, 0.0f);
+    m_numBuffered = 2 * m_halfLength;
+    m_outputNext = true;
+}
+
+size_t HalfBandDecimator::process(const float *input, size_t numSamples, size_t sampleStride, float *dest) {
+    if (numSamples == 0) {
+        return 0;
+    }
+    const size_t historyLength = 2 * m_halfLength;
+    m_buffer.resize(historyLength + numSamples);
+    for (size_t i=0; i<numSamples; ++i) {
+        m_buffer[m_numBuffered + i] = input[i * sampleStride];
+    }
+    m_numBuffered += numSamples;
+
+    // output sample m is centered on input position first - halfLength + 2m
+    const size_t first = historyLength + (m_outputNext ? 0 : 1);
+    const size_t numOutputs = first < m_numBuffered ? (m_numBuffered - first + 1) / 2 : 0;
+    const float *center = m_buffer.data() + first - m_halfLength;
+    OSCILLATORS_VECTORIZE
+    for (size_t m=0; m<numOutputs; ++m) {
+        dest[m] = m_centerTap * center[2 * m];
+    }
+    // taps in the outer loop, so that the inner loop vectorizes over output samples
+    for (size_t j=0; j<m_oddTaps.size(); ++j) {
+        const float tap = m_oddTaps[j];
+        const float *before = center - (2 * j + 1);
+        const float *after = center + (2 * j + 1);
+        OSCILLATORS_VECTORIZE
+        for (size_t m=0; m<numOutputs; ++m) {
+            dest[m] += tap * (before[2 * m] + after[2 * m]);
+        }
+    }
+    m_outputNext = ((m_numBuffered - first) % 2 == 0);
+
+    // keep the history for the next call
+    std::copy(m_buffer.end() - historyLength, m_buffer.end(), m_buffer.begin());
+    m_numBuffered = historyLength;
+    return numOutputs;
+}
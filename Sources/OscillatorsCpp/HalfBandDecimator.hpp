@@ -0,0 +1,69 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef HalfBandDecimator_hpp
+#define HalfBandDecimator_hpp
+
+#include <cstddef>
+#include <vector>
+
+namespace oscillators_cpp {
+
+/// Streaming decimation by 2 with a linear phase half-band FIR low-pass filter.
+/// Passband up to 0.2 x input sample rate (gain 1), stopband from 0.3 x input sample rate (about -80 dB).
+/// Even taps other than the center tap are zero, so only the odd taps are stored and applied.
+/// The filter delays the signal by (numTaps - 1) / 2 input samples.
+class HalfBandDecimator {
+private:
+    /// Odd taps of one half of the (symmetric) filter
+    std::vector<float> m_oddTaps;
+    float m_centerTap;
+    size_t m_halfLength;
+
+    /// Input history followed by the samples being processed
+    std::vector<float> m_buffer;
+    size_t m_numBuffered;
+    /// Whether the next input sample produces an output sample
+    bool m_outputNext;
+
+public:
+    explicit HalfBandDecimator(size_t numTaps = 47);
+
+    size_t numTaps() const { return 4 * m_oddTaps.size() - 1; }
+    /// Delay of the output, in input samples
+    size_t delay() const { return m_halfLength; }
+
+    /// Maximum number of output samples for a given number of input samples
+    static size_t maxOutputLength(size_t inputLength) { return inputLength / 2 + 1; }
+
+    /// Process numSamples input samples (read with sampleStride), write the output samples to dest.
+    /// Returns the number of output samples written.
+    size_t process(const float *input, size_t numSamples, size_t sampleStride, float *dest);
+
+    void reset();
+};
+
+} // oscillators_cpp
+
+#endif /* HalfBandDecimator_hpp */
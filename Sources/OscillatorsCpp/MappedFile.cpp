@@ -0,0 +1,78 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "MappedFile.hpp"
+#include "VectorOps.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace oscillators_cpp;
+
+MappedFile::MappedFile(const std::string &path, Access access) : m_data(nullptr), m_size(0) {
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        OSCILLATORS_THROW(std::runtime_error("Cannot open " + path + ": " + strerror(errno)));
+    }
+    struct stat status;
+    if (fstat(fd, &status) != 0) {
+        const int error = errno;
+        close(fd);
+        OSCILLATORS_THROW(std::runtime_error("Cannot stat " + path + ": " + strerror(error)));
+    }
+    m_size = static_cast<size_t>(status.st_size);
+    if (m_size > 0) {
+        void *data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            const int error = errno;
+            close(fd);
+            OSCILLATORS_THROW(std::runtime_error("Cannot map " + path + ": " + strerror(error)));
+        }
+        m_data = static_cast<const uint8_t*>(data);
+        madvise(data, m_size, access == Access::Sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+    }
+    // the mapping keeps the file open
+    close(fd);
+}
+
+void MappedFile::release(size_t end) {
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t length = std::min(end, m_size) / pageSize * pageSize;
+    if (m_data && length > 0) {
+        madvise(const_cast<uint8_t*>(m_data), length, MADV_DONTNEED);
+    }
+}
+
+MappedFile::~MappedFile() {
+    if (m_data) {
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+    }
+}
@@ -0,0 +1,66 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MappedFile_hpp
+#define MappedFile_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace oscillators_cpp {
+
+/// Read-only memory mapping of a whole file (POSIX), for zero-copy access to large inputs:
+/// pages are read on demand through the page cache, so memory use does not grow with the size of the file.
+class MappedFile {
+public:
+    /// Access pattern hint for the kernel (read-ahead)
+    enum class Access {
+        Sequential,
+        Random
+    };
+
+    MappedFile & operator=(const MappedFile&) = delete;
+    MappedFile(const MappedFile&) = delete;
+
+    explicit MappedFile(const std::string &path, Access access = Access::Sequential);
+    ~MappedFile();
+
+    /// Null for an empty file
+    const uint8_t *data() const { return m_data; }
+    size_t size() const { return m_size; }
+
+    /// Unmap the pages of [0, end) that have been read (whole pages only), e.g. behind the position of a sequential
+    /// reader, so that they do not count in the resident memory of the process. They stay in the page cache,
+    /// and are mapped again if accessed.
+    void release(size_t end);
+
+private:
+    const uint8_t *m_data;
+    size_t m_size;
+};
+
+} // oscillators_cpp
+
+#endif /* MappedFile_hpp */
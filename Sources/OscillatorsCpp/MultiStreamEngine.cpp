@@ -0,0 +1,285 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "MultiStreamEngine.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+using namespace oscillators_cpp;
+
+/// Idle workers wake up at least this often to look for streams to steal, in microseconds
+constexpr int64_t idlePollInterval = 1000;
+/// Weight of the last hop in the mean latency (exponential moving average)
+constexpr int64_t meanLatencyShift = 4;
+
+static int64_t now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+MultiStreamEngine::Stream::Stream(std::shared_ptr<const ResonatorBankVecTables> tables, size_t hopSize, size_t capacity, size_t homeWorker)
+: bank(new ResonatorBankVec(std::move(tables))), ringBuffer(std::max(capacity, 2 * hopSize)), hopSize(hopSize), homeWorker(homeWorker),
+scheduled(false), readyTime(0), overruns(0), droppedSamples(0), hopsProcessed(0), lastLatency(0), meanLatency(0), maxLatency(0) {
+    bank->setSnapshotsEnabled(true);
+}
+
+MultiStreamEngine::MultiStreamEngine(size_t maxStreams, size_t numThreads, bool pinThreads, HopCallback callback, void *context)
+: m_streams(maxStreams), m_numStreams(0), m_pinThreads(pinThreads), m_running(false), m_stop(false),
+m_callback(callback), m_context(context) {
+    if (numThreads == 0) {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    m_workers.reserve(numThreads);
+    for (size_t i=0; i<numThreads; ++i) {
+        m_workers.emplace_back(new Worker());
+        m_workers.back()->idle.store(false, std::memory_order_relaxed);
+    }
+}
+
+MultiStreamEngine::~MultiStreamEngine() {
+    stop();
+}
+
+size_t MultiStreamEngine::addStream(size_t numResonators, const float* frequencies, const float* alphas, const float* betas, float sampleRate,
+                                    size_t hopSize, size_t capacity) {
+    std::vector<float> configuration;
+    configuration.reserve(1 + 3 * numResonators);
+    configuration.push_back(sampleRate);
+    configuration.insert(configuration.end(), frequencies, frequencies + numResonators);
+    configuration.insert(configuration.end(), alphas, alphas + numResonators);
+    configuration.insert(configuration.end(), betas, betas + numResonators);
+
+    std::shared_ptr<const ResonatorBankVecTables> tables;
+    {
+        std::lock_guard<std::mutex> lock(m_streamsMutex);
+        std::weak_ptr<const ResonatorBankVecTables> &cached = m_tablesCache[configuration];
+        tables = cached.lock();
+        if (!tables) {
+            tables = std::make_shared<const ResonatorBankVecTables>(numResonators, frequencies, alphas, betas, sampleRate);
+            cached = tables;
+        }
+    }
+    return addStream(std::move(tables), hopSize, capacity);
+}
+
+size_t MultiStreamEngine::addStream(std::shared_ptr<const ResonatorBankVecTables> tables, size_t hopSize, size_t capacity) {
+    if (hopSize == 0) {
+        throw std::invalid_argument("Bad hopSize passed to addStream()");
+    }
+    std::lock_guard<std::mutex> lock(m_streamsMutex);
+    const size_t stream = m_numStreams.load(std::memory_order_relaxed);
+    if (stream >= m_streams.size()) {
+        throw std::length_error("Too many streams added to MultiStreamEngine");
+    }
+    // streams are spread over the workers round-robin, and stay on their home worker unless stolen
+    m_streams[stream].reset(new Stream(std::move(tables), hopSize, capacity, stream % m_workers.size()));
+    m_numStreams.store(stream + 1, std::memory_order_release);
+    return stream;
+}
+
+size_t MultiStreamEngine::numSharedTables() {
+    std::lock_guard<std::mutex> lock(m_streamsMutex);
+    return std::count_if(m_tablesCache.begin(), m_tablesCache.end(), [](const auto &entry) { return !entry.second.expired(); });
+}
+
+const std::shared_ptr<const ResonatorBankVecTables>& MultiStreamEngine::tables(size_t stream) const {
+    if (stream >= numStreams()) {
+        throw std::out_of_range("Bad stream passed to tables()");
+    }
+    return m_streams[stream]->bank->tables();
+}
+
+void MultiStreamEngine::start() {
+    if (m_running) {
+        return;
+    }
+    const size_t numCPUs = std::max(1u, std::thread::hardware_concurrency());
+    m_stop.store(false, std::memory_order_relaxed);
+    for (size_t i=0; i<m_workers.size(); ++i) {
+        m_workers[i]->thread = std::thread(&MultiStreamEngine::workerLoop, this, i);
+        if (m_pinThreads) {
+            pinToCPU(m_workers[i]->thread, i % numCPUs);
+        }
+    }
+    m_running = true;
+}
+
+void MultiStreamEngine::stop() {
+    if (!m_running) {
+        return;
+    }
+    m_stop.store(true);
+    for (auto &worker : m_workers) {
+        {
+            std::lock_guard<std::mutex> lock(worker->mutex);
+        }
+        worker->wakeUp.notify_one();
+    }
+    for (auto &worker : m_workers) {
+        worker->thread.join();
+    }
+    m_running = false;
+}
+
+size_t MultiStreamEngine::submit(size_t stream, const float *frameData, size_t frameLength, size_t sampleStride) {
+    if (stream >= numStreams()) {
+        throw std::out_of_range("Bad stream passed to submit()");
+    }
+    Stream &s = *m_streams[stream];
+    const size_t numSamples = (frameLength + sampleStride - 1) / sampleStride;
+    const size_t written = s.ringBuffer.write(frameData, frameLength, sampleStride);
+    if (written < numSamples) {
+        s.overruns.fetch_add(1, std::memory_order_relaxed);
+        s.droppedSamples.fetch_add(numSamples - written, std::memory_order_relaxed);
+    }
+    if (s.ringBuffer.size() >= s.hopSize && !s.scheduled.exchange(true)) {
+        s.readyTime.store(now(), std::memory_order_relaxed);
+        schedule(stream);
+    }
+    return written;
+}
+
+/// Queue a ready stream on its home worker's queue, and wake up the home worker if idle,
+/// or else an idle worker that will steal it
+void MultiStreamEngine::schedule(size_t stream) {
+    const size_t home = m_streams[stream]->homeWorker;
+    Worker &worker = *m_workers[home];
+    {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.queue.push_back(stream);
+    }
+    if (worker.idle.load()) {
+        worker.wakeUp.notify_one();
+        return;
+    }
+    for (size_t i=1; i<m_workers.size(); ++i) {
+        Worker &thief = *m_workers[(home + i) % m_workers.size()];
+        if (thief.idle.load()) {
+            thief.wakeUp.notify_one();
+            return;
+        }
+    }
+}
+
+/// Next stream for a worker: from the front of its own queue, or else stolen from the back of another worker's queue
+bool MultiStreamEngine::popStream(size_t workerIndex, size_t &stream) {
+    {
+        Worker &worker = *m_workers[workerIndex];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (!worker.queue.empty()) {
+            stream = worker.queue.front();
+            worker.queue.pop_front();
+            return true;
+        }
+    }
+    for (size_t i=1; i<m_workers.size(); ++i) {
+        Worker &victim = *m_workers[(workerIndex + i) % m_workers.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.queue.empty()) {
+            stream = victim.queue.back();
+            victim.queue.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+
+/// Run all the queued hops of a stream, then release it (and queue it again if a hop was queued in the meantime)
+void MultiStreamEngine::processStream(size_t workerIndex, size_t stream) {
+    Stream &s = *m_streams[stream];
+    Worker &worker = *m_workers[workerIndex];
+    ResonatorBankVec &bank = *s.bank;
+    const size_t numResonators = bank.numResonators();
+    worker.hop.resize(std::max(worker.hop.size(), s.hopSize));
+    if (m_callback) {
+        worker.powers.resize(std::max(worker.powers.size(), numResonators));
+    }
+
+    while (s.ringBuffer.size() >= s.hopSize) {
+        s.ringBuffer.read(worker.hop.data(), s.hopSize);
+        bank.update(worker.hop.data(), s.hopSize, 1);
+        if (m_callback) {
+            bank.getPowers(worker.powers.data(), numResonators);
+            m_callback(m_context, stream, worker.powers.data(), numResonators);
+        }
+        s.hopsProcessed.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    const int64_t latency = now() - s.readyTime.load(std::memory_order_relaxed);
+    const int64_t meanLatency = s.meanLatency.load(std::memory_order_relaxed);
+    s.lastLatency.store(latency, std::memory_order_relaxed);
+    s.meanLatency.store(meanLatency ? meanLatency + ((latency - meanLatency) >> meanLatencyShift) : latency, std::memory_order_relaxed);
+    s.maxLatency.store(std::max(s.maxLatency.load(std::memory_order_relaxed), latency), std::memory_order_relaxed);
+
+    s.scheduled.store(false);
+    if (s.ringBuffer.size() >= s.hopSize && !s.scheduled.exchange(true)) {
+        s.readyTime.store(now(), std::memory_order_relaxed);
+        schedule(stream);
+    }
+}
+
+void MultiStreamEngine::workerLoop(size_t workerIndex) {
+    Worker &worker = *m_workers[workerIndex];
+    while (!m_stop.load()) {
+        size_t stream;
+        if (popStream(workerIndex, stream)) {
+            processStream(workerIndex, stream);
+            continue;
+        }
+        // nothing to do: sleep until a stream is queued on this worker (or a thief is needed), or the poll interval
+        worker.idle.store(true);
+        {
+            std::unique_lock<std::mutex> lock(worker.mutex);
+            if (worker.queue.empty() && !m_stop.load()) {
+                worker.wakeUp.wait_for(lock, std::chrono::microseconds(idlePollInterval));
+            }
+        }
+        worker.idle.store(false);
+    }
+}
+
+uint64_t MultiStreamEngine::getSnapshot(size_t stream, float *powers, float *amplitudes, float *phases, size_t size) const {
+    if (stream >= numStreams()) {
+        throw std::out_of_range("Bad stream passed to getSnapshot()");
+    }
+    return m_streams[stream]->bank->getSnapshot(powers, amplitudes, phases, size);
+}
+
+MultiStreamEngine::StreamStats MultiStreamEngine::streamStats(size_t stream) const {
+    if (stream >= numStreams()) {
+        throw std::out_of_range("Bad stream passed to streamStats()");
+    }
+    const Stream &s = *m_streams[stream];
+    StreamStats stats;
+    stats.hopsProcessed = s.hopsProcessed.load(std::memory_order_relaxed);
+    stats.overruns = s.overruns.load(std::memory_order_relaxed);
+    stats.droppedSamples = s.droppedSamples.load(std::memory_order_relaxed);
+    stats.queueDepth = s.ringBuffer.size();
+    stats.homeWorker = s.homeWorker;
+    stats.lastLatency = 1e-9 * static_cast<double>(s.lastLatency.load(std::memory_order_relaxed));
+    stats.meanLatency = 1e-9 * static_cast<double>(s.meanLatency.load(std::memory_order_relaxed));
+    stats.maxLatency = 1e-9 * static_cast<double>(s.maxLatency.load(std::memory_order_relaxed));
+    return stats;
+}
@@ -0,0 +1,161 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MultiStreamEngine_hpp
+#define MultiStreamEngine_hpp
+
+#include "ResonatorBankVec.hpp"
+#include "RingBuffer.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace oscillators_cpp {
+
+/// Engine running many independent streams, one ResonatorBankVec per stream, on a fixed set of worker threads.
+/// - Each stream has a wait-free SPSC ring buffer: frames are submitted by one producer thread per stream,
+///   and a stream becomes ready when a full hop is queued.
+/// - Ready streams are queued on the worker queue of their home worker (assigned when the stream is added),
+///   so that a stream's state stays in the same core's cache; idle workers steal from the other queues.
+///   A stream is processed by at most one worker at a time, which drains all its queued hops.
+/// - Streams added with the same configuration share their coefficient tables (ResonatorBankVecTables).
+/// - Each stream's bank publishes a snapshot after each hop (see ResonatorBankVec::getSnapshot()), and per-stream
+///   statistics include the latency from the time the stream became ready to the end of its processing.
+class MultiStreamEngine {
+public:
+    /// Called on a worker thread after each hop, with the powers of the stream's bank (numResonators values)
+    typedef void (*HopCallback)(void *context, size_t stream, const float *powers, size_t numResonators);
+
+    struct StreamStats {
+        uint64_t hopsProcessed;
+        uint64_t overruns;
+        uint64_t droppedSamples;
+        size_t queueDepth;
+        size_t homeWorker;
+        /// Latencies (time from ready to processed), in seconds
+        double lastLatency;
+        double meanLatency;
+        double maxLatency;
+    };
+
+    MultiStreamEngine & operator=(const MultiStreamEngine&) = delete;
+    MultiStreamEngine(const MultiStreamEngine&) = delete;
+
+    /// maxStreams is the capacity of the engine (streams are never removed).
+    /// numThreads: number of worker threads, 0 for the number of hardware threads.
+    /// pinThreads sets the affinity of worker i to CPU i (Linux only, ignored elsewhere).
+    MultiStreamEngine(size_t maxStreams, size_t numThreads = 0, bool pinThreads = false,
+                      HopCallback callback = nullptr, void *context = nullptr);
+    ~MultiStreamEngine();
+
+    /// Add a stream, processed in hops of hopSize samples, buffering up to capacity samples; returns its ID.
+    /// The coefficient tables are shared with the existing streams of the same configuration.
+    /// Can be called while the engine is running.
+    size_t addStream(size_t numResonators, const float* frequencies, const float* alphas, const float* betas, float sampleRate,
+                     size_t hopSize, size_t capacity);
+    size_t addStream(std::shared_ptr<const ResonatorBankVecTables> tables, size_t hopSize, size_t capacity);
+
+    size_t numStreams() const { return m_numStreams.load(std::memory_order_acquire); }
+    size_t numThreads() const { return m_workers.size(); }
+    /// Number of distinct coefficient tables among the streams added with a configuration
+    size_t numSharedTables();
+    const std::shared_ptr<const ResonatorBankVecTables>& tables(size_t stream) const;
+
+    void start();
+    void stop();
+    bool running() const { return m_running; }
+
+    /// Producer of the stream (wait-free unless the stream becomes ready, in which case it is queued on its
+    /// home worker's queue): queue the samples of a frame (every sampleStride values of frameData).
+    /// Returns the number of samples queued (less than the frame on overrun).
+    size_t submit(size_t stream, const float *frameData, size_t frameLength, size_t sampleStride);
+
+    /// Latest hop processed for the stream (can be called from any thread, see ResonatorBankVec::getSnapshot())
+    uint64_t getSnapshot(size_t stream, float *powers, float *amplitudes, float *phases, size_t size) const;
+    StreamStats streamStats(size_t stream) const;
+
+private:
+    struct Stream {
+        std::unique_ptr<ResonatorBankVec> bank;
+        RingBuffer ringBuffer;
+        size_t hopSize;
+        size_t homeWorker;
+        /// Set when the stream is queued or being processed
+        std::atomic<bool> scheduled;
+        /// Time at which the stream became ready (steady clock, nanoseconds)
+        std::atomic<int64_t> readyTime;
+
+        std::atomic<uint64_t> overruns;
+        std::atomic<uint64_t> droppedSamples;
+        std::atomic<uint64_t> hopsProcessed;
+        std::atomic<int64_t> lastLatency;
+        std::atomic<int64_t> meanLatency;
+        std::atomic<int64_t> maxLatency;
+
+        Stream(std::shared_ptr<const ResonatorBankVecTables> tables, size_t hopSize, size_t capacity, size_t homeWorker);
+    };
+
+    struct Worker {
+        std::thread thread;
+        std::mutex mutex;
+        std::condition_variable wakeUp;
+        /// Ready streams: the worker pops from the front, thieves steal from the back
+        std::deque<size_t> queue;
+        std::atomic<bool> idle;
+        /// Hop samples and powers (intermediate calculations)
+        std::vector<float> hop;
+        std::vector<float> powers;
+    };
+
+    std::vector<std::unique_ptr<Stream>> m_streams;
+    std::atomic<size_t> m_numStreams;
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    bool m_pinThreads;
+    bool m_running;
+    std::atomic<bool> m_stop;
+    HopCallback m_callback;
+    void *m_context;
+
+    /// Serializes addStream(), protects the tables cache
+    std::mutex m_streamsMutex;
+    /// Tables of the streams added with a configuration, by configuration (sample rate, frequencies, alphas, betas)
+    std::map<std::vector<float>, std::weak_ptr<const ResonatorBankVecTables>> m_tablesCache;
+
+    void schedule(size_t stream);
+    bool popStream(size_t workerIndex, size_t &stream);
+    void processStream(size_t workerIndex, size_t stream);
+    void workerLoop(size_t workerIndex);
+};
+
+} // oscillators_cpp
+
+#endif /* MultiStreamEngine_hpp */
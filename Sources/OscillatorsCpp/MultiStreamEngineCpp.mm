@@ -0,0 +1,106 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#import "MultiStreamEngineCpp.h"
+
+#import <Foundation/Foundation.h>
+
+#include "MultiStreamEngine.hpp"
+
+using namespace oscillators_cpp;
+
+@interface MultiStreamEngineCpp()
+@property oscillators_cpp::MultiStreamEngine *engine;
+@end
+
+@implementation MultiStreamEngineCpp
+
+- (instancetype)initWithMaxStreams:(int)maxStreams numThreads:(int)numThreads {
+    if (self = [super init]) {
+        self.engine = new MultiStreamEngine(maxStreams, numThreads);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    delete self.engine;
+}
+
+- (int)addStreamWithNumResonators:(int)numResonators frequencies:(const float*)frequencies alphas:(const float*)alphas betas:(const float*)betas sampleRate:(float)sampleRate hopSize:(int)hopSize capacity:(int)capacity {
+    return static_cast<int>(self.engine->addStream(numResonators, frequencies, alphas, betas, sampleRate, hopSize, capacity));
+}
+
+- (int)numStreams {
+    return static_cast<int>(self.engine->numStreams());
+}
+
+- (int)numThreads {
+    return static_cast<int>(self.engine->numThreads());
+}
+
+- (int)numSharedTables {
+    return static_cast<int>(self.engine->numSharedTables());
+}
+
+- (void)start {
+    self.engine->start();
+}
+
+- (void)stop {
+    self.engine->stop();
+}
+
+- (bool)running {
+    return self.engine->running();
+}
+
+- (int)submit:(int)stream frame:(float*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride {
+    return static_cast<int>(self.engine->submit(stream, frame, frameLength, sampleStride));
+}
+
+- (int)getSnapshot:(int)stream powers:(float*)powers amplitudes:(float*)amplitudes phases:(float*)phases size:(int)size {
+    return static_cast<int>(self.engine->getSnapshot(stream, powers, amplitudes, phases, size));
+}
+
+- (int)hopsProcessed:(int)stream {
+    return static_cast<int>(self.engine->streamStats(stream).hopsProcessed);
+}
+
+- (int)overruns:(int)stream {
+    return static_cast<int>(self.engine->streamStats(stream).overruns);
+}
+
+- (int)queueDepth:(int)stream {
+    return static_cast<int>(self.engine->streamStats(stream).queueDepth);
+}
+
+- (double)meanLatency:(int)stream {
+    return self.engine->streamStats(stream).meanLatency;
+}
+
+- (double)maxLatency:(int)stream {
+    return self.engine->streamStats(stream).maxLatency;
+}
+
+@end
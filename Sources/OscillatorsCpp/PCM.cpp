@@ -0,0 +1,86 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "PCM.hpp"
+#include "VectorOps.hpp"
+
+#include <cstring>
+
+using namespace oscillators_cpp;
+
+size_t oscillators_cpp::pcmSampleSize(PCMFormat format) {
+    switch (format) {
+        case PCMFormat::Int16: return 2;
+        case PCMFormat::Int24: return 3;
+        case PCMFormat::Int32: return 4;
+    }
+    return 0;
+}
+
+float oscillators_cpp::pcmFullScale(PCMFormat format) {
+    switch (format) {
+        case PCMFormat::Int16: return 1.0f / 32768.0f;
+        case PCMFormat::Int24: return 1.0f / 8388608.0f;
+        case PCMFormat::Int32: return 1.0f / 2147483648.0f;
+    }
+    return 0.0f;
+}
+
+void oscillators_cpp::convertPCM(const void *data, PCMFormat format, size_t numSamples, size_t sampleStride, float scale, float *dest) {
+    const uint8_t *bytes = static_cast<const uint8_t*>(data);
+    switch (format) {
+        case PCMFormat::Int16: {
+            const size_t step = 2 * sampleStride;
+            OSCILLATORS_VECTORIZE
+            for (size_t i=0; i<numSamples; ++i) {
+                int16_t value;
+                memcpy(&value, bytes + i * step, sizeof(value));
+                dest[i] = scale * static_cast<float>(value);
+            }
+            break;
+        }
+        case PCMFormat::Int24: {
+            // the 3 bytes in the upper bytes of an int32 (sign included): the value times 256, exact as a float
+            const size_t step = 3 * sampleStride;
+            const float scale24 = scale * (1.0f / 256.0f);
+            OSCILLATORS_VECTORIZE
+            for (size_t i=0; i<numSamples; ++i) {
+                const uint8_t *sample = bytes + i * step;
+                const uint32_t shifted = (uint32_t(sample[0]) << 8) | (uint32_t(sample[1]) << 16) | (uint32_t(sample[2]) << 24);
+                dest[i] = scale24 * static_cast<float>(static_cast<int32_t>(shifted));
+            }
+            break;
+        }
+        case PCMFormat::Int32: {
+            const size_t step = 4 * sampleStride;
+            OSCILLATORS_VECTORIZE
+            for (size_t i=0; i<numSamples; ++i) {
+                int32_t value;
+                memcpy(&value, bytes + i * step, sizeof(value));
+                dest[i] = scale * static_cast<float>(value);
+            }
+            break;
+        }
+    }
+}
@@ -0,0 +1,56 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef PCM_hpp
+#define PCM_hpp
+
+#include <cstddef>
+#include <cstdint>
+
+namespace oscillators_cpp {
+
+/// Signed integer PCM sample formats, little-endian (Int24 packed in 3 bytes, as in WAV files and capture buffers).
+/// Int16 and Int32 samples are read in the native byte order (little-endian on all supported platforms).
+enum class PCMFormat {
+    Int16,
+    Int24,
+    Int32
+};
+
+/// Size of a sample in bytes
+size_t pcmSampleSize(PCMFormat format);
+/// Scale that maps the full range of the format to [-1, 1)
+float pcmFullScale(PCMFormat format);
+
+/// The frame updates from PCM data convert the samples in chunks of this many samples, kept in L1 cache,
+/// instead of converting whole frames to a temporary buffer
+constexpr size_t pcmChunkSize = 1024;
+
+/// Convert numSamples samples, every sampleStride samples of data (in samples of the format), to floats multiplied by scale.
+/// data needs no particular alignment.
+void convertPCM(const void *data, PCMFormat format, size_t numSamples, size_t sampleStride, float scale, float *dest);
+
+} // oscillators_cpp
+
+#endif /* PCM_hpp */
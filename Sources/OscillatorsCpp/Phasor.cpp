@@ -25,43 +25,48 @@ SOFTWARE.
 #include "Phasor.hpp"
 
 #include <cmath>
-#include <iostream>
-
-#include <Accelerate/Accelerate.h>
 
 using namespace oscillators_cpp;
 
-Phasor::Phasor(float frequency, float sampleRate)
+template <typename Real>
+PhasorT<Real>::PhasorT(Real frequency, Real sampleRate)
 : m_frequency(frequency), m_sampleRate(sampleRate),
 m_Zc(1.0), m_Zs(0.0) {
     updateMultiplier();
 }
 
-void Phasor::updateMultiplier() {
-    const float omega = twoPi * m_frequency / m_sampleRate;
+template <typename Real>
+void PhasorT<Real>::updateMultiplier() {
+    const Real omega = twoPiValue<Real> * m_frequency / m_sampleRate;
     m_Wc = cos(omega);
     m_Ws = sin(omega);
     m_Wcps = m_Wc + m_Ws;
 }
 
-void Phasor::setFrequency(float frequency) {
+template <typename Real>
+void PhasorT<Real>::setFrequency(Real frequency) {
     m_frequency = frequency;
     updateMultiplier();
 }
 
-void Phasor::incrementPhase() {
+template <typename Real>
+void PhasorT<Real>::incrementPhase() {
     // complex multiplication with 3 real multiplications
-    const float ac = m_Wc * m_Zc;
-    const float bd = m_Ws * m_Zs;
-    const float abcd = m_Wcps * (m_Zc + m_Zs);
+    const Real ac = m_Wc * m_Zc;
+    const Real bd = m_Ws * m_Zs;
+    const Real abcd = m_Wcps * (m_Zc + m_Zs);
     m_Zc = ac - bd;
     m_Zs = abcd - ac - bd;
 }
 
-void Phasor::stabilize(){
+template <typename Real>
+void PhasorT<Real>::stabilize(){
     // approximation for 1 / sqrt(x) around 1 (Taylor expansion)
     // sqrt(m_Zc*m_Zc + m_Zs*m_Zs) should be 1
-    const float k = (3.0 - m_Zc*m_Zc - m_Zs*m_Zs) / 2.0;
+    const Real k = (3.0 - m_Zc*m_Zc - m_Zs*m_Zs) / 2.0;
     m_Zc *= k;
     m_Zs *= k;
 }
+
+template class oscillators_cpp::PhasorT<float>;
+template class oscillators_cpp::PhasorT<double>;
@@ -31,37 +31,52 @@ namespace oscillators_cpp {
 
 constexpr float PI = 3.14159265358979323846; // PI
 constexpr float twoPi = 2.0 * PI;
+/// PI and 2 * PI in the precision of Real
+template <typename Real> constexpr Real piValue = static_cast<Real>(3.14159265358979323846);
+template <typename Real> constexpr Real twoPiValue = static_cast<Real>(2.0 * 3.14159265358979323846);
 
 // Phasor class: base for individual oscillators
-class Phasor {
+// Not polymorphic (no virtual functions, no vtable pointer), so that derived objects can be stored by value, contiguously
+// Templated on the precision of the frequency and phasor (float or double, explicitly instantiated in Phasor.cpp):
+// in float, the multiplier sits so close to 1 for very low frequencies at high sample rates that it limits the tuning accuracy
+template <typename Real>
+class PhasorT {
 protected:
-    float m_frequency;
-    float m_sampleRate;
+    Real m_frequency;
+    Real m_sampleRate;
     
     // Phasor
-    float m_Zc;
-    float m_Zs;
-    float m_Wc;
-    float m_Ws;
-    float m_Wcps;
+    Real m_Zc;
+    Real m_Zs;
+    Real m_Wc;
+    Real m_Ws;
+    Real m_Wcps;
 
     void updateMultiplier();
 
 public:
-    Phasor & operator=(const Phasor&) = delete;
-    Phasor(const Phasor&) = delete;
-    virtual ~Phasor() = default;
+    PhasorT & operator=(const PhasorT&) = delete;
+    PhasorT(const PhasorT&) = delete;
+    PhasorT(PhasorT&&) = default;
+    PhasorT & operator=(PhasorT&&) = default;
+    ~PhasorT() = default;
     
-    Phasor(float frequency, float sampleRate);
+    PhasorT(Real frequency, Real sampleRate);
 
-    float frequency() const { return m_frequency; }
-    void setFrequency(float frequency);
-    float sampleRate() const { return m_sampleRate; }
+    Real frequency() const { return m_frequency; }
+    void setFrequency(Real frequency);
+    Real sampleRate() const { return m_sampleRate; }
 
     void incrementPhase();
     void stabilize();
 };
 
+extern template class PhasorT<float>;
+extern template class PhasorT<double>;
+
+using Phasor = PhasorT<float>;
+using PhasorDouble = PhasorT<double>;
+
 } // oscillators_cpp
 
 #endif /* Phasor_hpp */
@@ -24,15 +24,20 @@ SOFTWARE.
 
 #include "Resonator.hpp"
 
-#include <Accelerate/Accelerate.h>
+#include <cmath>
+#include <stdexcept>
 
 using namespace oscillators_cpp;
 
-Resonator::Resonator(float frequency, float alpha, float beta, float sampleRate) : Phasor(frequency, sampleRate),
-m_alpha(alpha), m_omAlpha(1.0 - alpha), m_beta(beta), m_omBeta(1.0 - beta), m_trackedFrequency(m_frequency), m_phase(0.0) {
+template <typename Real, typename PhasorReal>
+ResonatorT<Real, PhasorReal>::ResonatorT(PhasorReal frequency, Real alpha, Real beta, PhasorReal sampleRate)
+: PhasorT<PhasorReal>(frequency, sampleRate),
+m_alpha(alpha), m_omAlpha(1.0 - alpha), m_cos(0.0), m_sin(0.0),
+m_beta(beta), m_omBeta(1.0 - beta), m_cc(0.0), m_ss(0.0), m_trackedFrequency(m_frequency), m_phase(0.0) {
 }
 
-void Resonator::setAlpha(float alpha) {
+template <typename Real, typename PhasorReal>
+void ResonatorT<Real, PhasorReal>::setAlpha(Real alpha) {
     if (alpha < 0.0 || alpha >1.0) {
         throw std::out_of_range("Bad alpha passed to setAlpha()");
     }
@@ -40,7 +45,8 @@ void Resonator::setAlpha(float alpha) {
     m_omAlpha = 1.0 - m_alpha;
 }
 
-void Resonator::setBeta(float beta) {
+template <typename Real, typename PhasorReal>
+void ResonatorT<Real, PhasorReal>::setBeta(Real beta) {
     if (beta < 0.0 || beta >1.0) {
         throw std::out_of_range("Bad beta passed to setBeta()");
     }
@@ -48,39 +54,66 @@ void Resonator::setBeta(float beta) {
     m_omBeta = 1.0 - m_beta;
 }
 
-void Resonator::updateWithSample(float sample) {
-    const float alphaSample = m_alpha * sample;
-    m_cos = m_omAlpha * m_cos + alphaSample * m_Zc;
-    m_sin = m_omAlpha * m_sin + alphaSample * m_Zs;
+template <typename Real, typename PhasorReal>
+void ResonatorT<Real, PhasorReal>::updateWithSample(Real sample) {
+    const Real alphaSample = m_alpha * sample;
+    // the phasor is rounded to the precision of the accumulators
+    m_cos = m_omAlpha * m_cos + alphaSample * static_cast<Real>(m_Zc);
+    m_sin = m_omAlpha * m_sin + alphaSample * static_cast<Real>(m_Zs);
     m_cc = m_omBeta * m_cc + m_beta * m_cos;
     m_ss = m_omBeta * m_ss + m_beta * m_sin;
-    incrementPhase();
+    this->incrementPhase();
 }
 
-void Resonator::update(const float sample) {
+template <typename Real, typename PhasorReal>
+void ResonatorT<Real, PhasorReal>::update(const Real sample) {
     updateWithSample(sample);
-    stabilize(); // this is overkill but necessary
+    this->stabilize(); // this is overkill but necessary
 }
 
-void Resonator::update(const std::vector<float> &samples) {
-    for (float sample : samples) {
+template <typename Real, typename PhasorReal>
+void ResonatorT<Real, PhasorReal>::update(const std::vector<Real> &samples) {
+    for (Real sample : samples) {
         updateWithSample(sample);
     }
-    stabilize(); // this is overkill but necessary
+    this->stabilize(); // this is overkill but necessary
 }
 
-void Resonator::update(const float *frameData, size_t frameLength, size_t sampleStride) {
-    for (int i=0; i<frameLength; i += sampleStride) {
-        updateWithSample(frameData[i]);
+/// Same computations as updateWithSample() for each sample of the frame,
+/// with the state held in local variables (frameData could alias the members otherwise)
+template <typename Real, typename PhasorReal>
+void ResonatorT<Real, PhasorReal>::updateFrame(const Real *frameData, size_t frameLength, size_t sampleStride) {
+    Real c = m_cos, s = m_sin, cc = m_cc, ss = m_ss;
+    PhasorReal zc = m_Zc, zs = m_Zs;
+    const Real alpha = m_alpha, omAlpha = m_omAlpha, beta = m_beta, omBeta = m_omBeta;
+    const PhasorReal wc = m_Wc, ws = m_Ws, wcps = m_Wcps;
+    for (size_t i=0; i<frameLength; i += sampleStride) {
+        const Real alphaSample = alpha * frameData[i];
+        c = omAlpha * c + alphaSample * static_cast<Real>(zc);
+        s = omAlpha * s + alphaSample * static_cast<Real>(zs);
+        cc = omBeta * cc + beta * c;
+        ss = omBeta * ss + beta * s;
+        // complex multiplication with 3 real multiplications
+        const PhasorReal ac = wc * zc;
+        const PhasorReal bd = ws * zs;
+        const PhasorReal abcd = wcps * (zc + zs);
+        zc = ac - bd;
+        zs = abcd - ac - bd;
     }
-    stabilize(); // this is overkill but necessary
+    m_cos = c; m_sin = s; m_cc = cc; m_ss = ss;
+    m_Zc = zc; m_Zs = zs;
 }
 
-void Resonator::updateAndTrack(const float *frameData, size_t frameLength, size_t sampleStride) {
-    for (int i=0; i<frameLength; i += sampleStride) {
-        updateWithSample(frameData[i]);
-    }
-    stabilize(); // this is overkill but necessary
+template <typename Real, typename PhasorReal>
+void ResonatorT<Real, PhasorReal>::update(const Real *frameData, size_t frameLength, size_t sampleStride) {
+    updateFrame(frameData, frameLength, sampleStride);
+    this->stabilize(); // this is overkill but necessary
+}
+
+template <typename Real, typename PhasorReal>
+void ResonatorT<Real, PhasorReal>::updateAndTrack(const Real *frameData, size_t frameLength, size_t sampleStride) {
+    updateFrame(frameData, frameLength, sampleStride);
+    this->stabilize(); // this is overkill but necessary
     if (amplitude() > trackFrequencyThreshold) {
         updateTrackedFrequency(frameLength);
     } else {
@@ -88,14 +121,89 @@ void Resonator::updateAndTrack(const float *frameData, size_t frameLength, size_
     }
 }
 
-void Resonator::updateTrackedFrequency(size_t numSamples) {
-    const float newPhase = atan2(m_ss, m_cc); // returns value in [-pi,pi]
-    float phaseDrift = newPhase - m_phase;
+template <typename Real, typename PhasorReal>
+size_t ResonatorT<Real, PhasorReal>::checkpointSize() {
+    return sizeof(CheckpointHeader) + checkpointSampleRateSize + checkpointRecordSize;
+}
+
+template <typename Real, typename PhasorReal>
+size_t ResonatorT<Real, PhasorReal>::saveCheckpoint(void *data, size_t size) const {
+    if (size < checkpointSize()) {
+        throw std::out_of_range("Buffer passed to saveCheckpoint() is not large enough");
+    }
+    const CheckpointHeader header = { checkpointMagic, checkpointVersion, static_cast<uint16_t>(CheckpointType::Resonator),
+        checkpointSize(), 1, static_cast<float>(m_sampleRate),
+        static_cast<uint8_t>(sizeof(Real)), static_cast<uint8_t>(sizeof(PhasorReal)), 0 };
+    CheckpointWriter writer(data, header);
+    saveSampleRate(writer, m_sampleRate);
+    saveRecord(writer);
+    return writer.offset();
+}
+
+template <typename Real, typename PhasorReal>
+void ResonatorT<Real, PhasorReal>::restoreCheckpoint(const void *data, size_t size) {
+    const CheckpointHeader header = readCheckpointHeader(data, size, CheckpointType::Resonator);
+    if (!checkpointPrecisionMatches<Real, PhasorReal>(header)) {
+        throw std::invalid_argument("Wrong precision of the checkpoint passed to restoreCheckpoint()");
+    }
+    if (header.numResonators != 1 || header.size != checkpointSize()) {
+        throw std::invalid_argument("Bad checkpoint passed to restoreCheckpoint()");
+    }
+    CheckpointReader reader(data);
+    const PhasorReal sampleRate = restoreSampleRate(reader, header);
+    restoreRecord(reader, sampleRate);
+}
+
+template <typename Real, typename PhasorReal>
+void ResonatorT<Real, PhasorReal>::saveRecord(CheckpointWriter &writer) const {
+    const Real coefficients[] = { m_alpha, m_beta, m_cos, m_sin, m_cc, m_ss };
+    const PhasorReal phasor[] = { m_Zc, m_Zs };
+    const Real tracking[] = { m_trackedFrequency, m_phase };
+    writer.write(m_frequency);
+    writer.write(coefficients, 6);
+    writer.write(phasor, 2);
+    writer.write(tracking, 2);
+}
+
+template <typename Real, typename PhasorReal>
+void ResonatorT<Real, PhasorReal>::restoreRecord(CheckpointReader &reader, PhasorReal sampleRate) {
+    const PhasorReal frequency = reader.read<PhasorReal>();
+    Real coefficients[6];
+    PhasorReal phasor[2];
+    Real tracking[2];
+    reader.read(coefficients, 6);
+    reader.read(phasor, 2);
+    reader.read(tracking, 2);
+    m_sampleRate = sampleRate;
+    this->setFrequency(frequency);
+    m_alpha = coefficients[0];
+    m_omAlpha = 1.0 - m_alpha;
+    m_beta = coefficients[1];
+    m_omBeta = 1.0 - m_beta;
+    m_cos = coefficients[2];
+    m_sin = coefficients[3];
+    m_cc = coefficients[4];
+    m_ss = coefficients[5];
+    m_Zc = phasor[0];
+    m_Zs = phasor[1];
+    m_trackedFrequency = tracking[0];
+    m_phase = tracking[1];
+}
+
+template <typename Real, typename PhasorReal>
+void ResonatorT<Real, PhasorReal>::updateTrackedFrequency(size_t numSamples) {
+    const Real newPhase = atan2(m_ss, m_cc); // returns value in [-pi,pi]
+    Real phaseDrift = newPhase - m_phase;
     m_phase = newPhase;
-    if (phaseDrift <= -PI) {
-        phaseDrift += twoPi;
-    } else if (phaseDrift > PI) {
-        phaseDrift -= twoPi;
+    if (phaseDrift <= -piValue<Real>) {
+        phaseDrift += twoPiValue<Real>;
+    } else if (phaseDrift > piValue<Real>) {
+        phaseDrift -= twoPiValue<Real>;
     }
-    m_trackedFrequency = m_frequency - (phaseDrift * m_sampleRate) / (twoPi * static_cast<float>(numSamples));
+    m_trackedFrequency = static_cast<Real>(m_frequency)
+        - (phaseDrift * static_cast<Real>(m_sampleRate)) / (twoPiValue<Real> * static_cast<Real>(numSamples));
 }
+
+template class oscillators_cpp::ResonatorT<float>;
+template class oscillators_cpp::ResonatorT<double>;
+template class oscillators_cpp::ResonatorT<float, double>;
@@ -25,54 +25,111 @@ SOFTWARE.
 #ifndef Resonator_hpp
 #define Resonator_hpp
 
+#include "Checkpoint.hpp"
 #include "Phasor.hpp"
 
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
 namespace oscillators_cpp {
 
 constexpr float trackFrequencyThreshold = 0.001;
 
-class Resonator : public Phasor {
+/// Resonator: Real is the precision of the samples, the resonance and its smoothing,
+/// PhasorReal the precision of the frequency and phasor (explicitly instantiated in Resonator.cpp for
+/// float/float, double/double, and float/double: double phasor with float accumulators)
+template <typename Real, typename PhasorReal = Real>
+class ResonatorT final : public PhasorT<PhasorReal> {
 private:
-    float m_alpha;
-    float m_omAlpha;
-    float m_cos;
-    float m_sin;
+    using PhasorT<PhasorReal>::m_frequency;
+    using PhasorT<PhasorReal>::m_sampleRate;
+    using PhasorT<PhasorReal>::m_Zc;
+    using PhasorT<PhasorReal>::m_Zs;
+    using PhasorT<PhasorReal>::m_Wc;
+    using PhasorT<PhasorReal>::m_Ws;
+    using PhasorT<PhasorReal>::m_Wcps;
+
+    Real m_alpha;
+    Real m_omAlpha;
+    Real m_cos;
+    Real m_sin;
     // smoothed
-    float m_beta;
-    float m_omBeta;
-    float m_cc;
-    float m_ss;
+    Real m_beta;
+    Real m_omBeta;
+    Real m_cc;
+    Real m_ss;
     
-    float m_trackedFrequency;
-    float m_phase;
+    Real m_trackedFrequency;
+    Real m_phase;
     
 public:
-    Resonator(float frequency, float alpha, float beta, float sampleRate);
+    ResonatorT(PhasorReal frequency, Real alpha, Real beta, PhasorReal sampleRate);
     
-    float power() const { return m_cc * m_cc + m_ss * m_ss; }
-    float amplitude() const { return sqrt(m_cc * m_cc + m_ss * m_ss); }
-    float alpha() const { return m_alpha; }
-    void setAlpha(float alpha);
-    float omAlpha() const { return m_omAlpha; }
-    float beta() const { return m_beta; }
-    void setBeta(float beta);
-    float c() const { return m_cos; }
-    float s() const { return m_sin; }
-    float cc() const { return m_cc; }
-    float ss() const { return m_ss; }
-    float phase() const { return m_phase; }
-    float trackedFrequency() const { return m_trackedFrequency; }
-
-    void updateWithSample(float sample);
-    void update(const float sample);
-    void update(const std::vector<float> &samples);
-    void update(const float *frameData, size_t frameLength, size_t sampleStride);
-    void updateAndTrack(const float *frameData, size_t frameLength, size_t sampleStride);
+    Real power() const { return m_cc * m_cc + m_ss * m_ss; }
+    Real amplitude() const { return std::sqrt(m_cc * m_cc + m_ss * m_ss); }
+    Real alpha() const { return m_alpha; }
+    void setAlpha(Real alpha);
+    Real omAlpha() const { return m_omAlpha; }
+    Real beta() const { return m_beta; }
+    void setBeta(Real beta);
+    Real c() const { return m_cos; }
+    Real s() const { return m_sin; }
+    Real cc() const { return m_cc; }
+    Real ss() const { return m_ss; }
+    Real phase() const { return m_phase; }
+    Real trackedFrequency() const { return m_trackedFrequency; }
+
+    void updateWithSample(Real sample);
+    void update(const Real sample);
+    void update(const std::vector<Real> &samples);
+    void update(const Real *frameData, size_t frameLength, size_t sampleStride);
+    void updateAndTrack(const Real *frameData, size_t frameLength, size_t sampleStride);
+
+    /// Checkpoint of the configuration and state (see Checkpoint.hpp).
+    /// saveCheckpoint() returns the number of bytes written (checkpointSize()).
+    static size_t checkpointSize();
+    size_t saveCheckpoint(void *data, size_t size) const;
+    void restoreCheckpoint(const void *data, size_t size);
+    /// Sample rate in a checkpoint: in float in the header, and in PhasorReal right after the header when PhasorReal
+    /// is not float (so that double precision instances restore their exact sample rate)
+    static constexpr size_t checkpointSampleRateSize = std::is_same<PhasorReal, float>::value ? 0 : sizeof(PhasorReal);
+    /// (defined here so that ResonatorBankVec can use them without linking the scalar classes)
+    static void saveSampleRate(CheckpointWriter &writer, PhasorReal sampleRate) {
+        if constexpr (checkpointSampleRateSize != 0) {
+            writer.write(sampleRate);
+        } else {
+            (void)writer;
+            (void)sampleRate;
+        }
+    }
+    static PhasorReal restoreSampleRate(CheckpointReader &reader, const CheckpointHeader &header) {
+        if constexpr (checkpointSampleRateSize != 0) {
+            return reader.read<PhasorReal>();
+        } else {
+            (void)reader;
+            return header.sampleRate;
+        }
+    }
+    /// Record of the configuration and state in a checkpoint (without header, sample rate excluded):
+    /// frequency and phasor in PhasorReal, the rest in Real, so checkpoints are restored with the same precision
+    static constexpr size_t checkpointRecordSize = 3 * sizeof(PhasorReal) + 8 * sizeof(Real);
+    void saveRecord(CheckpointWriter &writer) const;
+    void restoreRecord(CheckpointReader &reader, PhasorReal sampleRate);
 
 private:
+    void updateFrame(const Real *frameData, size_t frameLength, size_t sampleStride);
     void updateTrackedFrequency(size_t numSamples);
 };
 
+extern template class ResonatorT<float>;
+extern template class ResonatorT<double>;
+extern template class ResonatorT<float, double>;
+
+using Resonator = ResonatorT<float>;
+using ResonatorDouble = ResonatorT<double>;
+using ResonatorMixed = ResonatorT<float, double>;
+
 } // oscillators_cpp
 
 #endif /* Resonator_hpp */
@@ -24,125 +24,314 @@ SOFTWARE.
 
 #include "ResonatorBank.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include <thread>
+#include <type_traits>
+
 #ifndef STD_CONCURRENCY
 #include <dispatch/dispatch.h>
-#else
-#include <future>
 #endif
 
 using namespace oscillators_cpp;
 
-constexpr size_t resonatorStride = 6;
-
-ResonatorBank::ResonatorBank(size_t numResonators, const float* frequencies, const float* alphas, const float* betas, float sampleRate) : m_sampleRate(sampleRate) {
+template <typename Real, typename PhasorReal>
+ResonatorBankT<Real, PhasorReal>::ResonatorBankT(size_t numResonators, const Real* frequencies, const Real* alphas, const Real* betas,
+                                                 Real sampleRate, size_t numThreads, bool pinThreads) : m_sampleRate(sampleRate), m_snapshotVersion(0) {
     m_resonators.reserve(numResonators);
     for (size_t i=0; i<numResonators; ++i) {
-        m_resonators.emplace_back(std::make_unique<Resonator>(frequencies[i], alphas[i], betas[i], sampleRate));
+        m_resonators.emplace_back(frequencies[i], alphas[i], betas[i], sampleRate);
     }
+    if (numThreads == 0) {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    m_numChunks = std::max(size_t(1), std::min(numThreads, numResonators));
 #ifndef STD_CONCURRENCY
+    (void)pinThreads;
     m_dispatchGroup = dispatch_group_create();
     dispatch_retain(m_dispatchGroup);
     m_dispatchQueue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_HIGH, 0);
+#else
+    m_pinThreads = pinThreads;
 #endif
 }
 
 #ifndef STD_CONCURRENCY
-ResonatorBank::~ResonatorBank() {
+template <typename Real, typename PhasorReal>
+ResonatorBankT<Real, PhasorReal>::~ResonatorBankT() {
     dispatch_group_wait(m_dispatchGroup, dispatch_time(DISPATCH_TIME_NOW, 1000000000));
     dispatch_release(m_dispatchGroup);
 }
 #endif
 
-float ResonatorBank::frequencyValue(size_t index) {
+template <typename Real, typename PhasorReal>
+Real ResonatorBankT<Real, PhasorReal>::frequencyValue(size_t index) {
     if (index >= m_resonators.size()) {
         throw std::out_of_range("Bad index passed to frequencyValue()");
     }
-    return m_resonators[index]->frequency();
+    return m_resonators[index].frequency();
 }
 
-float ResonatorBank::alphaValue(size_t index) {
+template <typename Real, typename PhasorReal>
+Real ResonatorBankT<Real, PhasorReal>::alphaValue(size_t index) {
     if (index >= m_resonators.size()) {
         throw std::out_of_range("Bad index passed to alphaValue()");
     }
-    return m_resonators[index]->alpha();
+    return m_resonators[index].alpha();
 }
 
-void ResonatorBank::setAllAlphas(float alpha) {
+template <typename Real, typename PhasorReal>
+Real ResonatorBankT<Real, PhasorReal>::betaValue(size_t index) {
+    if (index >= m_resonators.size()) {
+        throw std::out_of_range("Bad index passed to betaValue()");
+    }
+    return m_resonators[index].beta();
+}
+
+template <typename Real, typename PhasorReal>
+ResonatorT<Real, PhasorReal>& ResonatorBankT<Real, PhasorReal>::resonator(size_t index) {
+    if (index >= m_resonators.size()) {
+        throw std::out_of_range("Bad index passed to resonator()");
+    }
+    return m_resonators[index];
+}
+
+template <typename Real, typename PhasorReal>
+const ResonatorT<Real, PhasorReal>& ResonatorBankT<Real, PhasorReal>::resonator(size_t index) const {
+    if (index >= m_resonators.size()) {
+        throw std::out_of_range("Bad index passed to resonator()");
+    }
+    return m_resonators[index];
+}
+
+template <typename Real, typename PhasorReal>
+void ResonatorBankT<Real, PhasorReal>::setAllAlphas(Real alpha) {
     if (alpha < 0.0 || alpha >1.0) {
         throw std::out_of_range("Bad alpha passed to setAllAlphas()");
     }
-    for (auto &resonatorPtr : m_resonators) {
-        resonatorPtr->setAlpha(alpha);
+    for (auto &resonator : m_resonators) {
+        resonator.setAlpha(alpha);
+    }
+}
+
+template <typename Real, typename PhasorReal>
+void ResonatorBankT<Real, PhasorReal>::getPowers(Real *dest, size_t size) {
+    for (size_t i=0; i<std::min(size, m_resonators.size()); ++i) {
+        dest[i]=m_resonators[i].power();
     }
 }
 
-void ResonatorBank::getPowers(float *dest, size_t size) {
+template <typename Real, typename PhasorReal>
+void ResonatorBankT<Real, PhasorReal>::getAmplitudes(Real *dest, size_t size) {
     for (size_t i=0; i<std::min(size, m_resonators.size()); ++i) {
-        dest[i]=m_resonators[i]->power();
+        dest[i]=m_resonators[i].amplitude();
     }
 }
 
-void ResonatorBank::getAmplitudes(float *dest, size_t size) {
+template <typename Real, typename PhasorReal>
+void ResonatorBankT<Real, PhasorReal>::getTrackedFrequencies(Real *dest, size_t size) {
     for (size_t i=0; i<std::min(size, m_resonators.size()); ++i) {
-        dest[i]=m_resonators[i]->amplitude();
+        dest[i]=m_resonators[i].trackedFrequency();
     }
 }
 
-void ResonatorBank::update(const float sample) {
-    for (auto &resonatorPtr : m_resonators) {
-        resonatorPtr->update(sample);
+template <typename Real, typename PhasorReal>
+void ResonatorBankT<Real, PhasorReal>::update(const Real sample) {
+    for (auto &resonator : m_resonators) {
+        resonator.update(sample);
     }
 }
 
-void ResonatorBank::update(const std::vector<float> &samples) {
-    for (auto &resonatorPtr : m_resonators) {
-        resonatorPtr->update(samples);
+template <typename Real, typename PhasorReal>
+void ResonatorBankT<Real, PhasorReal>::update(const std::vector<Real> &samples) {
+    for (auto &resonator : m_resonators) {
+        resonator.update(samples);
     }
 }
 
-void ResonatorBank::update(const float *frameData, size_t frameLength, size_t sampleStride) {
-    for (auto &resonatorPtr : m_resonators) {
-        resonatorPtr->update(frameData, frameLength, sampleStride);
+template <typename Real, typename PhasorReal>
+void ResonatorBankT<Real, PhasorReal>::update(const Real *frameData, size_t frameLength, size_t sampleStride) {
+    for (auto &resonator : m_resonators) {
+        resonator.update(frameData, frameLength, sampleStride);
+    }
+    publishSnapshot();
+}
+
+template <typename Real, typename PhasorReal>
+void ResonatorBankT<Real, PhasorReal>::update(const void *pcmData, PCMFormat format, size_t frameLength, size_t sampleStride, float scale) {
+    const size_t numSamples = (frameLength + sampleStride - 1) / sampleStride;
+    const uint8_t *data = static_cast<const uint8_t*>(pcmData);
+    const size_t step = sampleStride * pcmSampleSize(format);
+    float samples[pcmChunkSize];
+    // widened for double precision samples
+    Real realSamples[std::is_same<Real, float>::value ? 1 : pcmChunkSize];
+    for (size_t first = 0; first < numSamples; first += pcmChunkSize) {
+        const size_t count = std::min(pcmChunkSize, numSamples - first);
+        convertPCM(data + first * step, format, count, sampleStride, scale, samples);
+        const Real *chunk;
+        if constexpr (std::is_same<Real, float>::value) {
+            chunk = samples;
+        } else {
+            std::copy(samples, samples + count, realSamples);
+            chunk = realSamples;
+        }
+        for (auto &resonator : m_resonators) {
+            resonator.update(chunk, count, 1);
+        }
+    }
+    publishSnapshot();
+}
+
+template <typename Real, typename PhasorReal>
+void ResonatorBankT<Real, PhasorReal>::updateAndTrack(const Real *frameData, size_t frameLength, size_t sampleStride) {
+    for (auto &resonator : m_resonators) {
+        resonator.updateAndTrack(frameData, frameLength, sampleStride);
+    }
+    publishSnapshot();
+}
+
+/// Update the resonators of one contiguous chunk, so that each thread writes to its own range of resonators
+template <typename Real, typename PhasorReal>
+void ResonatorBankT<Real, PhasorReal>::updateChunk(size_t chunk, const Real *frameData, size_t frameLength, size_t sampleStride, bool track) {
+    const size_t begin = chunk * m_resonators.size() / m_numChunks;
+    const size_t end = (chunk + 1) * m_resonators.size() / m_numChunks;
+    if (track) {
+        for (size_t index = begin; index < end; ++index) {
+            m_resonators[index].updateAndTrack(frameData, frameLength, sampleStride);
+        }
+    } else {
+        for (size_t index = begin; index < end; ++index) {
+            m_resonators[index].update(frameData, frameLength, sampleStride);
+        }
     }
 }
 
 #ifndef STD_CONCURRENCY
 // concurrency with Apple GCD
 
-void ResonatorBank::updateConcurrent(const float *frameData, size_t frameLength, size_t sampleStride) {
-    for (size_t offset = 0; offset < resonatorStride; ++offset) {
+template <typename Real, typename PhasorReal>
+void ResonatorBankT<Real, PhasorReal>::updateChunksConcurrent(const Real *frameData, size_t frameLength, size_t sampleStride, bool track) {
+    for (size_t chunk = 0; chunk < m_numChunks; ++chunk) {
         dispatch_group_async(m_dispatchGroup, m_dispatchQueue, ^{
-            size_t index = offset;
-            while (index < m_resonators.size()) {
-                m_resonators[index]->update(frameData, frameLength, sampleStride);
-                index += resonatorStride;
-            }
+            updateChunk(chunk, frameData, frameLength, sampleStride, track);
         });
     }
     dispatch_group_wait(m_dispatchGroup, DISPATCH_TIME_FOREVER);
 }
 
 #else
-// concurrency with std::async
+// concurrency with a persistent thread pool, created on first use (the calling thread updates the first chunk)
+
+template <typename Real, typename PhasorReal>
+void ResonatorBankT<Real, PhasorReal>::updateChunksConcurrent(const Real *frameData, size_t frameLength, size_t sampleStride, bool track) {
+    if (m_numChunks == 1) {
+        updateChunk(0, frameData, frameLength, sampleStride, track);
+        return;
+    }
+    if (!m_threadPool) {
+        m_threadPool = std::make_unique<ThreadPool>(m_numChunks, m_pinThreads);
+    }
+    m_threadPool->run(m_numChunks, [&](size_t chunk) {
+        updateChunk(chunk, frameData, frameLength, sampleStride, track);
+    });
+}
+#endif
 
-void ResonatorBank::updateConcurrent(const float *frameData, size_t frameLength, size_t sampleStride) {
-    std::vector<std::future<void>> handles;
-    handles.reserve(resonatorStride);
-    for (size_t offset = 0; offset < resonatorStride; ++offset) {
-        auto handle = std::async(std::launch::async, &ResonatorBank::updateEvery, this, resonatorStride, offset, frameData, frameLength, sampleStride);
-        handles.emplace_back(std::move(handle));
+template <typename Real, typename PhasorReal>
+void ResonatorBankT<Real, PhasorReal>::updateConcurrent(const Real *frameData, size_t frameLength, size_t sampleStride) {
+    updateChunksConcurrent(frameData, frameLength, sampleStride, false);
+    publishSnapshot();
+}
+
+template <typename Real, typename PhasorReal>
+void ResonatorBankT<Real, PhasorReal>::updateAndTrackConcurrent(const Real *frameData, size_t frameLength, size_t sampleStride) {
+    updateChunksConcurrent(frameData, frameLength, sampleStride, true);
+    publishSnapshot();
+}
+
+template <typename Real, typename PhasorReal>
+void ResonatorBankT<Real, PhasorReal>::setSnapshotsEnabled(bool enabled) {
+    if (!enabled) {
+        m_snapshot.reset();
+        return;
     }
-    for (auto& handle : handles) {
-        handle.wait();
+    if (!m_snapshot) {
+        m_snapshot = std::make_unique<Snapshot>(3, m_resonators.size());
+        m_snapshotValues.resize(3 * m_resonators.size());
     }
 }
 
-void ResonatorBank::updateEvery(size_t stride, size_t offset, const float *frameData, size_t frameLength, size_t sampleStride) {
-    size_t index = offset;
-    while (index < m_resonators.size()) {
-        m_resonators[index]->update(frameData, frameLength, sampleStride);
-        index += stride;
+/// Publish the powers, amplitudes and phases at the end of a frame, if snapshots are enabled
+template <typename Real, typename PhasorReal>
+void ResonatorBankT<Real, PhasorReal>::publishSnapshot() {
+    if (!m_snapshot) {
+        return;
     }
+    const size_t n = m_resonators.size();
+    float *values = m_snapshotValues.data();
+    for (size_t i=0; i<n; ++i) {
+        const ResonatorT<Real, PhasorReal> &resonator = m_resonators[i];
+        values[i] = resonator.power();
+        values[n + i] = resonator.amplitude();
+        values[2 * n + i] = std::atan2(resonator.ss(), resonator.cc());
+    }
+    m_snapshot->publish(values, ++m_snapshotVersion);
+}
+
+template <typename Real, typename PhasorReal>
+uint64_t ResonatorBankT<Real, PhasorReal>::getSnapshot(float *powers, float *amplitudes, float *phases, size_t size) const {
+    if (size < m_resonators.size()) {
+        throw std::out_of_range("Buffer passed to getSnapshot() is not large enough");
+    }
+    if (!m_snapshot) {
+        return 0;
+    }
+    float *const fields[3] = { powers, amplitudes, phases };
+    return m_snapshot->read(fields);
+}
+
+template <typename Real, typename PhasorReal>
+size_t ResonatorBankT<Real, PhasorReal>::checkpointSize() const {
+    return sizeof(CheckpointHeader) + ResonatorT<Real, PhasorReal>::checkpointSampleRateSize +
+        m_resonators.size() * ResonatorT<Real, PhasorReal>::checkpointRecordSize;
+}
+
+template <typename Real, typename PhasorReal>
+size_t ResonatorBankT<Real, PhasorReal>::saveCheckpoint(void *data, size_t size) const {
+    if (size < checkpointSize()) {
+        throw std::out_of_range("Buffer passed to saveCheckpoint() is not large enough");
+    }
+    const CheckpointHeader header = { checkpointMagic, checkpointVersion, static_cast<uint16_t>(CheckpointType::ResonatorBank),
+        checkpointSize(), m_resonators.size(), static_cast<float>(m_sampleRate),
+        static_cast<uint8_t>(sizeof(Real)), static_cast<uint8_t>(sizeof(PhasorReal)), 0 };
+    CheckpointWriter writer(data, header);
+    ResonatorT<Real, PhasorReal>::saveSampleRate(writer, m_sampleRate);
+    for (const auto &resonator : m_resonators) {
+        resonator.saveRecord(writer);
+    }
+    return writer.offset();
+}
+
+template <typename Real, typename PhasorReal>
+void ResonatorBankT<Real, PhasorReal>::restoreCheckpoint(const void *data, size_t size) {
+    const CheckpointHeader header = readCheckpointHeader(data, size, CheckpointType::ResonatorBank);
+    if (!checkpointPrecisionMatches<Real, PhasorReal>(header)) {
+        throw std::invalid_argument("Wrong precision of the checkpoint passed to restoreCheckpoint()");
+    }
+    if (header.numResonators != m_resonators.size() || header.size != checkpointSize()) {
+        throw std::invalid_argument("Bad checkpoint passed to restoreCheckpoint()");
+    }
+    CheckpointReader reader(data);
+    const PhasorReal sampleRate = ResonatorT<Real, PhasorReal>::restoreSampleRate(reader, header);
+    m_sampleRate = static_cast<Real>(sampleRate);
+    for (auto &resonator : m_resonators) {
+        resonator.restoreRecord(reader, sampleRate);
+    }
+    publishSnapshot();
 }
-#endif
 
+template class oscillators_cpp::ResonatorBankT<float>;
+template class oscillators_cpp::ResonatorBankT<double>;
+template class oscillators_cpp::ResonatorBankT<float, double>;
@@ -25,58 +25,125 @@ SOFTWARE.
 #ifndef ResonatorBank_hpp
 #define ResonatorBank_hpp
 
+#include "PCM.hpp"
 #include "Resonator.hpp"
+#include "Snapshot.hpp"
 
+#include <cstdint>
+#include <memory>
 #include <vector>
 
-// use GCD concurrency by default
-// uncomment the next line to use std::async instead
+// use GCD concurrency by default on Apple platforms, a persistent ThreadPool elsewhere
+// uncomment the next line to use the ThreadPool on Apple platforms as well
 // #define STD_CONCURRENCY
 
+#if !defined(__APPLE__) && !defined(STD_CONCURRENCY)
+#define STD_CONCURRENCY
+#endif
+
 #ifndef STD_CONCURRENCY
 #include <dispatch/dispatch.h>
+#else
+#include "ThreadPool.hpp"
 #endif
 
 namespace oscillators_cpp {
 
-class ResonatorBank {
+/// Bank of Resonator objects, stored by value in a single contiguous array (packed, no per-resonator allocation).
+/// Concurrent updates process contiguous chunks of resonators, so threads only share cache lines at chunk boundaries.
+/// Templated on the precisions of the resonators (see ResonatorT), explicitly instantiated in ResonatorBank.cpp:
+/// samples, coefficients and results are in Real (snapshots are published in float).
+template <typename Real, typename PhasorReal = Real>
+class ResonatorBankT {
 private:
-    float m_sampleRate;
-    std::vector<std::unique_ptr<Resonator> > m_resonators;
+    Real m_sampleRate;
+    std::vector<ResonatorT<Real, PhasorReal>> m_resonators;
+
+    /// Number of contiguous chunks of resonators updated concurrently
+    size_t m_numChunks;
 
 #ifndef STD_CONCURRENCY
     dispatch_group_t m_dispatchGroup;
     dispatch_queue_t m_dispatchQueue;
+#else
+    /// Created by the first concurrent update, so that banks only updated sequentially start no threads
+    std::unique_ptr<ThreadPool> m_threadPool;
+    bool m_pinThreads;
 #endif
 
-public:
-    ResonatorBank & operator=(const ResonatorBank&) = delete;
-    ResonatorBank(const ResonatorBank&) = delete;
+    void updateChunk(size_t chunk, const Real *frameData, size_t frameLength, size_t sampleStride, bool track);
+    void updateChunksConcurrent(const Real *frameData, size_t frameLength, size_t sampleStride, bool track);
+
+    /// Snapshots: published powers | amplitudes | phases (null if disabled)
+    std::unique_ptr<Snapshot> m_snapshot;
+    /// Snapshots: values to publish (intermediate calculations)
+    std::vector<float> m_snapshotValues;
+    /// Snapshots: number of frames published
+    uint64_t m_snapshotVersion;
+
+    void publishSnapshot();
 
-    ResonatorBank(size_t numResonators, const float* frequencies, const float* alphas, const float* betas, float sampleRate);
+public:
+    ResonatorBankT & operator=(const ResonatorBankT&) = delete;
+    ResonatorBankT(const ResonatorBankT&) = delete;
+
+    /// numThreads: number of threads (and contiguous chunks of resonators) used by updateConcurrent, 0 for the number of hardware threads.
+    /// The threads are only started by the first concurrent update.
+    /// pinThreads: pin the worker threads to CPUs (ThreadPool only, Linux only)
+    ResonatorBankT(size_t numResonators, const Real* frequencies, const Real* alphas, const Real* betas, Real sampleRate,
+                   size_t numThreads = 0, bool pinThreads = false);
 #ifndef STD_CONCURRENCY
-    ~ResonatorBank();
+    ~ResonatorBankT();
 #endif
 
-    float sampleRate() { return m_sampleRate; }
+    Real sampleRate() { return m_sampleRate; }
     size_t numResonators() { return m_resonators.size(); }
-    float frequencyValue(size_t index);
-    float alphaValue(size_t index);
-    void setAllAlphas(float alpha);
-    void getPowers(float *dest, size_t size);
-    void getAmplitudes(float *dest, size_t size);
-    void update(const float sample);
-    void update(const std::vector<float> &samples);
-    void update(const float *frameData, size_t frameLength, size_t sampleStride);
-    void updateConcurrent(const float *frameData, size_t frameLength, size_t sampleStride);
-    
-#ifdef STD_CONCURRENCY
-private:
-    void updateEvery(size_t mod, size_t offset, const float *frameData, size_t frameLength, size_t sampleStride);
-#endif
-
+    size_t numThreads() { return m_numChunks; }
+    Real frequencyValue(size_t index);
+    Real alphaValue(size_t index);
+    Real betaValue(size_t index);
+    void setAllAlphas(Real alpha);
+    void getPowers(Real *dest, size_t size);
+    void getAmplitudes(Real *dest, size_t size);
+    void getTrackedFrequencies(Real *dest, size_t size);
+
+    /// Per-resonator access (phase, tracked frequency, etc.)
+    ResonatorT<Real, PhasorReal>& resonator(size_t index);
+    const ResonatorT<Real, PhasorReal>& resonator(size_t index) const;
+
+    void update(const Real sample);
+    void update(const std::vector<Real> &samples);
+    void update(const Real *frameData, size_t frameLength, size_t sampleStride);
+    /// Frame of integer PCM samples (frameLength and sampleStride in samples of the format), converted on the fly
+    /// and multiplied by scale (e.g. pcmFullScale(format)). The resonators are updated chunk by chunk (see pcmChunkSize).
+    void update(const void *pcmData, PCMFormat format, size_t frameLength, size_t sampleStride, float scale);
+    void updateConcurrent(const Real *frameData, size_t frameLength, size_t sampleStride);
+    void updateAndTrack(const Real *frameData, size_t frameLength, size_t sampleStride);
+    void updateAndTrackConcurrent(const Real *frameData, size_t frameLength, size_t sampleStride);
+
+    /// Result snapshots (disabled by default), for readers on other threads: the frame updates publish
+    /// the powers, amplitudes and phases (of the smoothed resonance) at the end of each frame, see ResonatorBankVec.
+    void setSnapshotsEnabled(bool enabled);
+    bool snapshotsEnabled() const { return m_snapshot != nullptr; }
+    uint64_t getSnapshot(float *powers, float *amplitudes, float *phases, size_t size) const;
+
+    /// Checkpoint of the configuration and state of all the resonators (see Checkpoint.hpp):
+    /// one Resonator record per resonator. A checkpoint is restored into a bank with the same number of resonators
+    /// and precisions.
+    size_t checkpointSize() const;
+    size_t saveCheckpoint(void *data, size_t size) const;
+    void restoreCheckpoint(const void *data, size_t size);
 };
 
+extern template class ResonatorBankT<float>;
+extern template class ResonatorBankT<double>;
+extern template class ResonatorBankT<float, double>;
+
+using ResonatorBank = ResonatorBankT<float>;
+using ResonatorBankDouble = ResonatorBankT<double>;
+/// Double precision phasors (tuning accuracy for very low frequencies) with float accumulators
+using ResonatorBankMixed = ResonatorBankT<float, double>;
+
 } // oscillators_cpp
 
 #endif /* ResonatorBank_hpp */
@@ -43,6 +43,13 @@ using namespace oscillators_cpp;
     return self;
 }
 
+- (instancetype)initWithNumResonators:(int)numResonators frequencies:(const float*)frequencies alphas:(const float*)alphas betas: (const float*)betas sampleRate:(float)sampleRate numThreads:(int)numThreads {
+    if (self = [super init]) {
+        self.resonatorBank = new ResonatorBank(numResonators, frequencies, alphas, betas, sampleRate, numThreads);
+    }
+    return self;
+}
+
 - (void)dealloc {
     delete self.resonatorBank;
 }
@@ -55,6 +62,10 @@ using namespace oscillators_cpp;
     return static_cast<int>(self.resonatorBank->numResonators());
 }
 
+- (int)numThreads {
+    return static_cast<int>(self.resonatorBank->numThreads());
+}
+
 - (float)frequencyValue:(int)index {
     return self.resonatorBank->frequencyValue(index);
 }
@@ -63,6 +74,18 @@ using namespace oscillators_cpp;
     return self.resonatorBank->alphaValue(index);
 }
 
+- (float)betaValue:(int)index {
+    return self.resonatorBank->betaValue(index);
+}
+
+- (float)phaseValue:(int)index {
+    return self.resonatorBank->resonator(index).phase();
+}
+
+- (float)trackedFrequencyValue:(int)index {
+    return self.resonatorBank->resonator(index).trackedFrequency();
+}
+
 - (void)setAllAlphas:(float)alpha {
     self.resonatorBank->setAllAlphas(alpha);
 }
@@ -83,6 +106,10 @@ using namespace oscillators_cpp;
 //    return self.resonatorBank->amplitudeValue(index);
 //}
 
+- (void)getTrackedFrequencies:(float*)dest size:(int)size {
+    self.resonatorBank->getTrackedFrequencies(dest, size);
+}
+
 - (void)update:(float)sample {
     self.resonatorBank->update(sample);
 }
@@ -91,8 +118,52 @@ using namespace oscillators_cpp;
     self.resonatorBank->update(frame, frameLength, sampleStride);
 }
 
+- (void)updateInt16:(const int16_t*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride scale:(float)scale {
+    self.resonatorBank->update(frame, PCMFormat::Int16, frameLength, sampleStride, scale);
+}
+
+- (void)updateInt24:(const void*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride scale:(float)scale {
+    self.resonatorBank->update(frame, PCMFormat::Int24, frameLength, sampleStride, scale);
+}
+
+- (void)updateInt32:(const int32_t*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride scale:(float)scale {
+    self.resonatorBank->update(frame, PCMFormat::Int32, frameLength, sampleStride, scale);
+}
+
 - (void)updateConcurrent:(float*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride {
     self.resonatorBank->updateConcurrent(frame, frameLength, sampleStride);
 }
 
+- (void)updateAndTrack:(float*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride {
+    self.resonatorBank->updateAndTrack(frame, frameLength, sampleStride);
+}
+
+- (void)updateAndTrackConcurrent:(float*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride {
+    self.resonatorBank->updateAndTrackConcurrent(frame, frameLength, sampleStride);
+}
+
+- (void)setSnapshotsEnabled:(bool)enabled {
+    self.resonatorBank->setSnapshotsEnabled(enabled);
+}
+
+- (bool)snapshotsEnabled {
+    return self.resonatorBank->snapshotsEnabled();
+}
+
+- (int)getSnapshotPowers:(float*)powers amplitudes:(float*)amplitudes phases:(float*)phases size:(int)size {
+    return static_cast<int>(self.resonatorBank->getSnapshot(powers, amplitudes, phases, size));
+}
+
+- (int)checkpointSize {
+    return static_cast<int>(self.resonatorBank->checkpointSize());
+}
+
+- (int)saveCheckpoint:(void*)data size:(int)size {
+    return static_cast<int>(self.resonatorBank->saveCheckpoint(data, size));
+}
+
+- (void)restoreCheckpoint:(const void*)data size:(int)size {
+    self.resonatorBank->restoreCheckpoint(data, size);
+}
+
 @end
@@ -0,0 +1,138 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#import "ResonatorBankDoubleCpp.h"
+
+#import <Foundation/Foundation.h>
+
+#include "ResonatorBank.hpp"
+
+using namespace oscillators_cpp;
+
+@interface ResonatorBankDoubleCpp()
+@property oscillators_cpp::ResonatorBankDouble *resonatorBank;
+@end
+
+@implementation ResonatorBankDoubleCpp
+
+- (instancetype)initWithNumResonators:(int)numResonators frequencies:(const double*)frequencies alphas:(const double*)alphas betas: (const double*)betas sampleRate:(double)sampleRate {
+    if (self = [super init]) {
+        self.resonatorBank = new ResonatorBankDouble(numResonators, frequencies, alphas, betas, sampleRate);
+    }
+    return self;
+}
+
+- (instancetype)initWithNumResonators:(int)numResonators frequencies:(const double*)frequencies alphas:(const double*)alphas betas: (const double*)betas sampleRate:(double)sampleRate numThreads:(int)numThreads {
+    if (self = [super init]) {
+        self.resonatorBank = new ResonatorBankDouble(numResonators, frequencies, alphas, betas, sampleRate, numThreads);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    delete self.resonatorBank;
+}
+
+- (double)sampleRate {
+    return self.resonatorBank->sampleRate();
+}
+
+- (int)numResonators {
+    return static_cast<int>(self.resonatorBank->numResonators());
+}
+
+- (int)numThreads {
+    return static_cast<int>(self.resonatorBank->numThreads());
+}
+
+- (double)frequencyValue:(int)index {
+    return self.resonatorBank->frequencyValue(index);
+}
+
+- (double)alphaValue:(int)index {
+    return self.resonatorBank->alphaValue(index);
+}
+
+- (double)betaValue:(int)index {
+    return self.resonatorBank->betaValue(index);
+}
+
+- (double)phaseValue:(int)index {
+    return self.resonatorBank->resonator(index).phase();
+}
+
+- (double)trackedFrequencyValue:(int)index {
+    return self.resonatorBank->resonator(index).trackedFrequency();
+}
+
+- (void)setAllAlphas:(double)alpha {
+    self.resonatorBank->setAllAlphas(alpha);
+}
+
+- (void)getPowers:(double*)dest size: (int)size {
+    self.resonatorBank->getPowers(dest, size);
+}
+
+- (void)getAmplitudes:(double*)dest size: (int)size {
+    self.resonatorBank->getAmplitudes(dest, size);
+}
+
+- (void)getTrackedFrequencies:(double*)dest size:(int)size {
+    self.resonatorBank->getTrackedFrequencies(dest, size);
+}
+
+- (void)update:(double)sample {
+    self.resonatorBank->update(sample);
+}
+
+- (void)update:(double*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride {
+    self.resonatorBank->update(frame, frameLength, sampleStride);
+}
+
+- (void)updateConcurrent:(double*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride {
+    self.resonatorBank->updateConcurrent(frame, frameLength, sampleStride);
+}
+
+- (void)updateAndTrack:(double*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride {
+    self.resonatorBank->updateAndTrack(frame, frameLength, sampleStride);
+}
+
+- (void)updateAndTrackConcurrent:(double*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride {
+    self.resonatorBank->updateAndTrackConcurrent(frame, frameLength, sampleStride);
+}
+
+- (int)checkpointSize {
+    return static_cast<int>(self.resonatorBank->checkpointSize());
+}
+
+- (int)saveCheckpoint:(void*)data size:(int)size {
+    return static_cast<int>(self.resonatorBank->saveCheckpoint(data, size));
+}
+
+- (void)restoreCheckpoint:(const void*)data size:(int)size {
+    self.resonatorBank->restoreCheckpoint(data, size);
+}
+
+@end
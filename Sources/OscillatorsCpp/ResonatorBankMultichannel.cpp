@@ -0,0 +1,131 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "ResonatorBankMultichannel.hpp"
+#include "VectorOps.hpp"
+
+#include <stdexcept>
+
+using namespace oscillators_cpp;
+
+ResonatorBankMultichannel::ResonatorBankMultichannel(size_t numChannels, size_t numResonators, const float* frequencies, const float* alphas, const float* betas, float sampleRate)
+: ResonatorBankMultichannel(numChannels, std::make_shared<ResonatorBankVecTables>(numResonators, frequencies, alphas, betas, sampleRate)) {
+}
+
+ResonatorBankMultichannel::ResonatorBankMultichannel(size_t numChannels, std::shared_ptr<const ResonatorBankVecTables> tables)
+: m_tables(std::move(tables)), m_numChannels(numChannels),
+m_kernels(&kernels(bestKernelVariant())) {
+    if (numChannels == 0) {
+        throw std::invalid_argument("Bad number of channels passed to ResonatorBankMultichannel()");
+    }
+    m_numResonators = m_tables->numResonators;
+    m_stride = m_tables->stride;
+    m_channelSize = 2 * m_stride;
+
+    // setup resonators
+    m_r.assign(m_numChannels * m_channelSize, 0.0f);
+    m_rr.assign(m_numChannels * m_channelSize, 0.0f);
+
+    // setup phasors
+    m_z.resize(m_channelSize);
+    vops::fill(1.0f, m_z.data(), m_stride);
+    vops::fill(0.0f, m_z.data() + m_stride, m_stride);
+}
+
+void ResonatorBankMultichannel::setKernelVariant(KernelVariant variant) {
+    m_kernels = &kernels(variant);
+}
+
+float ResonatorBankMultichannel::frequencyValue(size_t index) {
+    if (index >= m_numResonators) {
+        throw std::out_of_range("Bad index passed to frequencyValue()");
+    }
+    return m_tables->frequencies[index];
+}
+
+float ResonatorBankMultichannel::alphaValue(size_t index) {
+    if (index >= m_numResonators) {
+        throw std::out_of_range("Bad index passed to alphaValue()");
+    }
+    return m_tables->alphas[index];
+}
+
+float ResonatorBankMultichannel::betaValue(size_t index) {
+    if (index >= m_numResonators) {
+        throw std::out_of_range("Bad index passed to betaValue()");
+    }
+    return m_tables->betas[index];
+}
+
+void ResonatorBankMultichannel::getPowers(float *dest, size_t size) {
+    if (size < m_numChannels * m_numResonators)
+    {
+        throw std::out_of_range("Buffer passed to getPowers() is not large enough");
+    }
+    for (size_t c=0; c<m_numChannels; ++c) {
+        m_kernels->powers(m_numResonators, m_stride, m_rr.data() + c * m_channelSize, dest + c * m_numResonators);
+    }
+}
+
+void ResonatorBankMultichannel::getAmplitudes(float *dest, size_t size) {
+    if (size < m_numChannels * m_numResonators)
+    {
+        throw std::out_of_range("Buffer passed to getAmplitudes() is not large enough");
+    }
+    for (size_t c=0; c<m_numChannels; ++c) {
+        m_kernels->amplitudes(m_numResonators, m_stride, m_rr.data() + c * m_channelSize, dest + c * m_numResonators);
+    }
+}
+
+void ResonatorBankMultichannel::getChannelPowers(size_t channel, float *dest, size_t size) {
+    if (channel >= m_numChannels) {
+        throw std::out_of_range("Bad index passed to getChannelPowers()");
+    }
+    if (size < m_numResonators)
+    {
+        throw std::out_of_range("Buffer passed to getChannelPowers() is not large enough");
+    }
+    m_kernels->powers(m_numResonators, m_stride, m_rr.data() + channel * m_channelSize, dest);
+}
+
+void ResonatorBankMultichannel::update(const float *frameData, size_t frameLength, size_t sampleStride) {
+    if (sampleStride < m_numChannels) {
+        throw std::invalid_argument("Bad sampleStride passed to update(): less than the number of channels");
+    }
+    if (frameLength % sampleStride != 0) {
+        throw std::invalid_argument("Bad frameLength passed to update(): not a whole number of samples");
+    }
+    // the padding resonators have neutral coefficients: process whole kernel blocks
+    const ResonatorBankVecTables &tables = *m_tables;
+    m_kernels->updateMultichannel(tables.paddedNumResonators, m_stride, m_numChannels, m_channelSize,
+                                  m_r.data(), m_rr.data(), m_z.data(), tables.w.data(),
+                                  tables.alphas.data(), tables.omAlphas.data(), tables.betas.data(), tables.omBetas.data(),
+                                  frameData, frameLength / sampleStride, sampleStride);
+    stabilize(); // this is overkill but necessary
+}
+
+/// Apply norm correction to the shared phasors
+void ResonatorBankMultichannel::stabilize() {
+    m_kernels->stabilize(m_tables->paddedNumResonators, m_stride, m_z.data());
+}
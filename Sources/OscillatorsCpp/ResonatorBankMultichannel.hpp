@@ -0,0 +1,101 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef ResonatorBankMultichannel_hpp
+#define ResonatorBankMultichannel_hpp
+
+#include "ResonatorBankVec.hpp"
+#include "ResonatorBankVecKernels.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace oscillators_cpp {
+
+/// Bank of resonators applied to each channel of a multichannel signal.
+/// All channels share the same frequencies, alphas and betas, hence the same phasors and coefficient tables
+/// (ResonatorBankVecTables, which can also be shared with ResonatorBankVec banks).
+/// The update is blocked in samples: the phasors of a block of samples are computed once and reused by every channel,
+/// so that the per-sample phasor rotation is done once for all channels, and the phasors are stabilized once per frame.
+/// R and RR are stored channel-major, each channel with the ResonatorBankVec layout.
+class ResonatorBankMultichannel {
+private:
+    std::shared_ptr<const ResonatorBankVecTables> m_tables;
+    size_t m_numChannels;
+    size_t m_numResonators;
+    /// Offset of the imaginary parts in R, RR and Z (the stride of the tables)
+    size_t m_stride;
+    /// Number of values per channel in R and RR (2 * stride)
+    size_t m_channelSize;
+
+    /// Accumulated resonance values, channel-major, non-interlaced real | imaginary parts for each channel
+    AlignedVector<float> m_r;
+    /// Smoothed accumulated resonance values, same layout as m_r
+    AlignedVector<float> m_rr;
+
+    /// Phasors, shared by all channels, non-interlaced real | imaginary parts
+    AlignedVector<float> m_z;
+
+    /// Kernel functions for the instruction set variant in use
+    const ResonatorBankVecKernels *m_kernels;
+
+public:
+    ResonatorBankMultichannel & operator=(const ResonatorBankMultichannel&) = delete;
+    ResonatorBankMultichannel(const ResonatorBankMultichannel&) = delete;
+
+    ResonatorBankMultichannel(size_t numChannels, size_t numResonators, const float* frequencies, const float* alphas, const float* betas, float sampleRate);
+    /// Bank sharing existing coefficient tables (e.g. those of a ResonatorBankVec, see ResonatorBankVec::tables())
+    ResonatorBankMultichannel(size_t numChannels, std::shared_ptr<const ResonatorBankVecTables> tables);
+
+    float sampleRate() { return m_tables->sampleRate; }
+    size_t numChannels() { return m_numChannels; }
+    size_t numResonators() { return m_numResonators; }
+    float frequencyValue(size_t index);
+    float alphaValue(size_t index);
+    float betaValue(size_t index);
+
+    const std::shared_ptr<const ResonatorBankVecTables>& tables() const { return m_tables; }
+
+    KernelVariant kernelVariant() const { return m_kernels->variant; }
+    void setKernelVariant(KernelVariant variant);
+
+    /// Powers as a numChannels x numResonators matrix (one row per channel), dest must hold numChannels * numResonators values
+    void getPowers(float *dest, size_t size);
+    /// Amplitudes as a numChannels x numResonators matrix (one row per channel)
+    void getAmplitudes(float *dest, size_t size);
+    /// Powers for one channel, dest must hold numResonators values
+    void getChannelPowers(size_t channel, float *dest, size_t size);
+
+    /// Process an interleaved multichannel frame: frameLength values (a multiple of sampleStride),
+    /// sampleStride (>= numChannels) values per sample, channel c of the bank reads value c of each sample.
+    /// Apply stabilization (norm correction) at the end
+    void update(const float *frameData, size_t frameLength, size_t sampleStride);
+
+    void stabilize();
+};
+
+} // oscillators_cpp
+
+#endif /* ResonatorBankMultichannel_hpp */
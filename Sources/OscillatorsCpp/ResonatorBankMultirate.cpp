@@ -0,0 +1,212 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "ResonatorBankMultirate.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+using namespace oscillators_cpp;
+
+ResonatorBankMultirate::ResonatorBankMultirate(size_t numResonators, const float* frequencies, const float* alphas, const float* betas, float sampleRate,
+                                               float maxRelativeFrequency, size_t maxOctaves)
+: m_sampleRate(sampleRate), m_numResonators(numResonators),
+m_frequencies(frequencies, frequencies + numResonators),
+m_alphas(alphas, alphas + numResonators),
+m_betas(betas, betas + numResonators) {
+    if (maxRelativeFrequency <= 0.0f || maxRelativeFrequency > 0.5f) {
+        throw std::out_of_range("Bad maxRelativeFrequency passed to ResonatorBankMultirate()");
+    }
+
+    // assign each resonator to an octave
+    std::vector<std::vector<size_t> > octaves(maxOctaves + 1);
+    size_t numOctaves = 0;
+    for (size_t i=0; i<numResonators; ++i) {
+        size_t octave = 0;
+        float rate = sampleRate;
+        while (octave < maxOctaves && m_frequencies[i] <= maxRelativeFrequency * rate / 2.0f) {
+            rate /= 2.0f;
+            ++octave;
+        }
+        octaves[octave].push_back(i);
+        numOctaves = std::max(numOctaves, octave);
+    }
+
+    // one bank per non empty octave, with rescaled alphas and betas
+    for (size_t octave=0; octave<=numOctaves; ++octave) {
+        const std::vector<size_t> &indices = octaves[octave];
+        if (indices.empty()) {
+            continue;
+        }
+        const size_t decimation = size_t(1) << octave;
+        std::vector<float> levelFrequencies, levelAlphas, levelBetas;
+        for (size_t index : indices) {
+            levelFrequencies.push_back(m_frequencies[index]);
+            levelAlphas.push_back(static_cast<float>(1.0 - std::pow(1.0 - m_alphas[index], static_cast<double>(decimation))));
+            levelBetas.push_back(static_cast<float>(1.0 - std::pow(1.0 - m_betas[index], static_cast<double>(decimation))));
+        }
+        Level level;
+        level.octave = octave;
+        level.decimation = decimation;
+        level.bank = std::make_unique<ResonatorBankVec>(indices.size(), levelFrequencies, levelAlphas, levelBetas,
+                                                        sampleRate / static_cast<float>(decimation));
+        level.indices = indices;
+        level.delayPosition = 0;
+        m_levels.push_back(std::move(level));
+    }
+
+    m_decimators.resize(numOctaves);
+    m_decimated.resize(numOctaves);
+    m_levelValues.resize(numResonators);
+
+    // a sample at octave L lags the input by stageDelay x (2^L - 1) input samples, i.e. stageDelay x (2^(M-L) - 1)
+    // samples at its rate less than at the lowest octave M
+    const size_t stageDelay = m_decimators.empty() ? 0 : m_decimators.front().delay();
+    m_delay = stageDelay * ((size_t(1) << numOctaves) - 1);
+    for (Level &level : m_levels) {
+        level.delayLine.assign(stageDelay * ((size_t(1) << (numOctaves - level.octave)) - 1), 0.0f);
+    }
+}
+
+float ResonatorBankMultirate::frequencyValue(size_t index) {
+    if (index >= m_numResonators) {
+        throw std::out_of_range("Bad index passed to frequencyValue()");
+    }
+    return m_frequencies[index];
+}
+
+float ResonatorBankMultirate::alphaValue(size_t index) {
+    if (index >= m_numResonators) {
+        throw std::out_of_range("Bad index passed to alphaValue()");
+    }
+    return m_alphas[index];
+}
+
+float ResonatorBankMultirate::betaValue(size_t index) {
+    if (index >= m_numResonators) {
+        throw std::out_of_range("Bad index passed to betaValue()");
+    }
+    return m_betas[index];
+}
+
+size_t ResonatorBankMultirate::decimationValue(size_t index) {
+    if (index >= m_numResonators) {
+        throw std::out_of_range("Bad index passed to decimationValue()");
+    }
+    for (const Level &level : m_levels) {
+        for (size_t levelIndex : level.indices) {
+            if (levelIndex == index) {
+                return level.decimation;
+            }
+        }
+    }
+    return 1;
+}
+
+void ResonatorBankMultirate::gather(float *dest, bool amplitudes) {
+    for (Level &level : m_levels) {
+        const size_t count = level.indices.size();
+        if (amplitudes) {
+            level.bank->getAmplitudes(m_levelValues.data(), count);
+        } else {
+            level.bank->getPowers(m_levelValues.data(), count);
+        }
+        for (size_t j=0; j<count; ++j) {
+            dest[level.indices[j]] = m_levelValues[j];
+        }
+    }
+}
+
+void ResonatorBankMultirate::getPowers(float *dest, size_t size) {
+    if (size < m_numResonators)
+    {
+        throw std::out_of_range("Buffer passed to getPowers() is not large enough");
+    }
+    gather(dest, false);
+}
+
+void ResonatorBankMultirate::getAmplitudes(float *dest, size_t size) {
+    if (size < m_numResonators)
+    {
+        throw std::out_of_range("Buffer passed to getAmplitudes() is not large enough");
+    }
+    gather(dest, true);
+}
+
+void ResonatorBankMultirate::delaySamples(Level &level, const float *samples, size_t numSamples, size_t sampleStride) {
+    m_delayed.resize(numSamples);
+    for (size_t i=0; i<numSamples; ++i) {
+        m_delayed[i] = samples[i * sampleStride];
+    }
+    // each sample is swapped with the oldest sample of the delay line
+    const size_t length = level.delayLine.size();
+    for (size_t done=0; done<numSamples; ) {
+        const size_t count = std::min(numSamples - done, length - level.delayPosition);
+        std::swap_ranges(m_delayed.begin() + done, m_delayed.begin() + done + count, level.delayLine.begin() + level.delayPosition);
+        done += count;
+        level.delayPosition = (level.delayPosition + count) % length;
+    }
+}
+
+void ResonatorBankMultirate::update(const std::vector<float> &samples) {
+    update(samples.data(), samples.size(), 1);
+}
+
+/// Process a frame of samples: decimate the frame down the octaves, then update each octave's bank (through its delay line)
+void ResonatorBankMultirate::update(const float *frameData, size_t frameLength, size_t sampleStride) {
+    const float *input = frameData;
+    size_t inputLength = (frameLength + sampleStride - 1) / sampleStride;
+    size_t inputStride = sampleStride;
+    for (size_t octave=0; octave<m_decimators.size(); ++octave) {
+        std::vector<float> &output = m_decimated[octave];
+        output.resize(HalfBandDecimator::maxOutputLength(inputLength));
+        const size_t outputLength = m_decimators[octave].process(input, inputLength, inputStride, output.data());
+        output.resize(outputLength);
+        input = output.data();
+        inputLength = outputLength;
+        inputStride = 1;
+    }
+
+    for (Level &level : m_levels) {
+        // input samples at octave 0, samples decimated by the level's octave decimator below
+        const float *samples = frameData;
+        size_t length = frameLength;
+        size_t stride = sampleStride;
+        if (level.octave > 0) {
+            samples = m_decimated[level.octave - 1].data();
+            length = m_decimated[level.octave - 1].size();
+            stride = 1;
+        }
+        if (!level.delayLine.empty()) {
+            delaySamples(level, samples, (length + stride - 1) / stride, stride);
+            samples = m_delayed.data();
+            length = m_delayed.size();
+            stride = 1;
+        }
+        if (length > 0) {
+            level.bank->update(samples, length, stride);
+        }
+    }
+}
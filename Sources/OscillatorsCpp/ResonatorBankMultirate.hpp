@@ -0,0 +1,116 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef ResonatorBankMultirate_hpp
+#define ResonatorBankMultirate_hpp
+
+#include "HalfBandDecimator.hpp"
+#include "ResonatorBankVec.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace oscillators_cpp {
+
+/// Multirate resonator bank.
+/// Resonators are grouped by octave: group L runs at sampleRate / 2^L, fed by a cascade of half-band decimators,
+/// with alphas and betas rescaled so that time constants are preserved (alpha_L = 1 - (1 - alpha)^(2^L)).
+/// A resonator is assigned to the lowest rate at which its frequency stays below maxRelativeFrequency x rate.
+/// Powers and amplitudes are reported for all resonators, in the order of the frequencies passed to the constructor.
+/// Each decimation stage delays the signal by (numTaps - 1) / 2 samples at its input rate: the samples of every level
+/// but the lowest go through a delay line that matches the cascade delay of the lowest level, so that all the groups
+/// are aligned in time, and lag the input by delay() samples.
+class ResonatorBankMultirate {
+private:
+    struct Level {
+        /// Octave below the input rate, the level's rate is sampleRate / decimation with decimation = 2^octave
+        size_t octave;
+        size_t decimation;
+        std::unique_ptr<ResonatorBankVec> bank;
+        /// Index of each of the level's resonators in the bank as a whole
+        std::vector<size_t> indices;
+        /// Samples at the level's rate that make up the difference with the cascade delay of the lowest level,
+        /// oldest at delayPosition (empty for the lowest level)
+        std::vector<float> delayLine;
+        size_t delayPosition;
+    };
+
+    float m_sampleRate;
+    size_t m_numResonators;
+    std::vector<float> m_frequencies;
+    std::vector<float> m_alphas;
+    std::vector<float> m_betas;
+
+    /// Levels with at least one resonator, by increasing decimation
+    std::vector<Level> m_levels;
+    /// One decimator per octave, up to the lowest rate in use
+    std::vector<HalfBandDecimator> m_decimators;
+
+    /// Decimated samples for the current frame, one buffer per octave (intermediate calculations)
+    std::vector<std::vector<float> > m_decimated;
+    /// Level powers or amplitudes (intermediate calculations)
+    std::vector<float> m_levelValues;
+    /// Delayed samples of a level (intermediate calculations)
+    std::vector<float> m_delayed;
+    /// Cascade delay of the lowest level, in samples at the input rate
+    size_t m_delay;
+
+    void gather(float *dest, bool amplitudes);
+    /// Pass the samples through the level's delay line, into m_delayed
+    void delaySamples(Level &level, const float *samples, size_t numSamples, size_t sampleStride);
+
+public:
+    static constexpr float defaultMaxRelativeFrequency = 0.2f;
+    static constexpr size_t defaultMaxOctaves = 10;
+
+    ResonatorBankMultirate & operator=(const ResonatorBankMultirate&) = delete;
+    ResonatorBankMultirate(const ResonatorBankMultirate&) = delete;
+
+    ResonatorBankMultirate(size_t numResonators, const float* frequencies, const float* alphas, const float* betas, float sampleRate,
+                           float maxRelativeFrequency = defaultMaxRelativeFrequency, size_t maxOctaves = defaultMaxOctaves);
+
+    float sampleRate() { return m_sampleRate; }
+    size_t numResonators() { return m_numResonators; }
+    float frequencyValue(size_t index);
+    float alphaValue(size_t index);
+    float betaValue(size_t index);
+
+    /// Number of octaves below the input rate used by the bank
+    size_t numOctaves() { return m_decimators.size(); }
+    /// Decimation factor of the resonator's group
+    size_t decimationValue(size_t index);
+    /// Delay of the outputs of all the groups relative to the input, in samples at the input rate
+    size_t delay() { return m_delay; }
+
+    void getPowers(float *dest, size_t size);
+    void getAmplitudes(float *dest, size_t size);
+
+    void update(const std::vector<float> &samples);
+    void update(const float *frameData, size_t frameLength, size_t sampleStride);
+};
+
+} // oscillators_cpp
+
+#endif /* ResonatorBankMultirate_hpp */
@@ -0,0 +1,94 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#import "ResonatorBankMultirateCpp.h"
+
+#import <Foundation/Foundation.h>
+
+#include "ResonatorBankMultirate.hpp"
+
+using namespace oscillators_cpp;
+
+@interface ResonatorBankMultirateCpp()
+@property oscillators_cpp::ResonatorBankMultirate *resonatorBank;
+@end
+
+@implementation ResonatorBankMultirateCpp
+
+- (instancetype)initWithNumResonators:(int)numResonators frequencies:(const float*)frequencies alphas:(const float*)alphas betas:(const float*)betas sampleRate:(float)sampleRate {
+    if (self = [super init]) {
+        self.resonatorBank = new ResonatorBankMultirate(numResonators, frequencies, alphas, betas, sampleRate);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    delete self.resonatorBank;
+}
+
+- (float)sampleRate {
+    return self.resonatorBank->sampleRate();
+}
+
+- (int)numResonators {
+    return static_cast<int>(self.resonatorBank->numResonators());
+}
+
+- (int)numOctaves {
+    return static_cast<int>(self.resonatorBank->numOctaves());
+}
+
+- (float)frequencyValue:(int)index {
+    return self.resonatorBank->frequencyValue(index);
+}
+
+- (float)alphaValue:(int)index {
+    return self.resonatorBank->alphaValue(index);
+}
+
+- (float)betaValue:(int)index {
+    return self.resonatorBank->betaValue(index);
+}
+
+- (int)decimationValue:(int)index {
+    return static_cast<int>(self.resonatorBank->decimationValue(index));
+}
+
+- (int)delay {
+    return static_cast<int>(self.resonatorBank->delay());
+}
+
+- (void)getPowers:(float*)dest size: (int)size {
+    self.resonatorBank->getPowers(dest, size);
+}
+
+- (void)getAmplitudes:(float*)dest size: (int)size {
+    self.resonatorBank->getAmplitudes(dest, size);
+}
+
+- (void)update:(float*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride {
+    self.resonatorBank->update(frame, frameLength, sampleStride);
+}
+
+@end
@@ -23,186 +23,1481 @@ SOFTWARE.
 */
 
 #include "ResonatorBankVec.hpp"
+#include "Float16.hpp"
+#include "Resonator.hpp" // PI, twoPi, twoPiValue, trackFrequencyThreshold
+#include "VectorOps.hpp"
 
-#include <Accelerate/Accelerate.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
 
 using namespace oscillators_cpp;
 
-constexpr float PI = 3.14159265358979323846; // PI
-constexpr float twoPi = 2.0 * PI;
+/// Concurrent update: maximum number of resonators per shard (64 bytes of state and coefficients per resonator)
+constexpr size_t maxShardSize = 1024;
+/// Resonator arrays are padded to a multiple of this number of resonators (the largest kernel block)
+constexpr size_t resonatorAlignment = 32;
+/// Concurrent update: shard boundaries are multiples of this number of resonators
+constexpr size_t shardAlignment = resonatorAlignment;
+/// Silence: shorter runs of silent samples are processed by the update kernel
+constexpr size_t minSilentRun = 64;
+/// Silence: R and RR values below this magnitude are flushed to zero (well above the denormal range,
+/// so that products in the update kernel stay normal)
+constexpr float flushThreshold = 1e-30f;
 
-ResonatorBankVec::ResonatorBankVec(size_t numResonators, const std::vector<float> &frequencies, const std::vector<float> &alphas, const std::vector<float> &betas, float sampleRate)
-: ResonatorBankVec(numResonators, frequencies.data(), alphas.data(), betas.data(), sampleRate) {
+/// Phasor resync: initial interval in samples, when adaptive
+constexpr size_t defaultResyncInterval = 16384;
+/// Phasor resync: bounds of the adaptive interval
+constexpr size_t minResyncInterval = 1024;
+constexpr size_t maxResyncInterval = size_t(1) << 22;
+/// Phasor resync: the adaptive interval is halved when the drift (largest distance between a phasor and its
+/// exact value) exceeds this target, and doubled when the drift is below half of it (the drift grows linearly)
+constexpr float resyncDriftTarget = 1e-4f;
+
+/// Checkpoint: silence threshold, phasor resync enabled, samples since output, fixed resync interval,
+/// resync interval, samples since resync
+template <typename Real>
+constexpr size_t checkpointScalarsSize = sizeof(Real) + sizeof(uint32_t) + 4 * sizeof(uint64_t);
+
+/// sum_{j=1..L} a^j b^(L-j), the contribution of R to RR over L samples without input (divided by beta)
+static double decaySum(double a, double b, double length) {
+    if (a == b) {
+        return length * std::pow(a, length);
+    }
+    if (b == 0.0) {
+        return std::pow(a, length);
+    }
+    // (a/b)^L - 1 without cancellation when a and b are close
+    return a * std::pow(b, length) * std::expm1(length * std::log1p((a - b) / b)) / (a - b);
 }
 
-ResonatorBankVec::ResonatorBankVec(size_t numResonators, const float* frequencies, const float* alphas, const float* betas, float sampleRate)
-: m_sampleRate(sampleRate), m_numResonators(numResonators), m_twoNumResonators(2*numResonators) {
-    
-    constexpr float zero = 0.0f;
-    constexpr float one = 1.0f;
-    constexpr float minusOne = -1.0f;
-
-    // initialize from passed frequencies
-    m_frequencies.resize(m_numResonators);
-    memcpy(m_frequencies.data(), frequencies, m_numResonators * sizeof(float));
-
-    // These must be 2 * numResonators size
-    m_alphas.resize(m_twoNumResonators);
-    memcpy(m_alphas.data(), alphas, m_numResonators * sizeof(float));
-    memcpy(m_alphas.data() + m_numResonators, alphas, m_numResonators * sizeof(float));
-        
-    m_omAlphas.resize(m_twoNumResonators);
-    vDSP_vfill(&one, m_omAlphas.data(), 1, m_twoNumResonators);
-    vDSP_vsmsa(m_alphas.data(), 1, &minusOne, &one, m_omAlphas.data(), 1, m_twoNumResonators);
-    
-    m_betas.resize(m_twoNumResonators);
-    memcpy(m_betas.data(), betas, m_numResonators * sizeof(float));
-    memcpy(m_betas.data() + m_numResonators, betas, m_numResonators * sizeof(float));
-        
-    m_omBetas.resize(m_twoNumResonators);
-    vDSP_vfill(&one, m_omBetas.data(), 1, m_twoNumResonators);
-    vDSP_vsmsa(m_betas.data(), 1, &minusOne, &one, m_omBetas.data(), 1, m_twoNumResonators);
-
-    // setup resonators
-    m_r.resize(m_twoNumResonators);
-    vDSP_vfill(&zero, m_r.data(), 1, m_twoNumResonators);
-    
-    m_rr.resize(m_twoNumResonators);
-    vDSP_vfill(&zero, m_rr.data(), 1, m_twoNumResonators);
-    
-    m_z.resize(m_twoNumResonators);
-    vDSP_vfill(&one, m_z.data(), 1, m_numResonators);
-    vDSP_vfill(&zero, m_z.data()+ m_numResonators, 1, m_numResonators);
+/// Set values of x with a magnitude below flushThreshold to zero
+template <typename Real>
+static void flushTiny(Real *x, size_t n) {
+    OSCILLATORS_VECTORIZE
+    for (size_t i=0; i<n; ++i) {
+        x[i] = std::fabs(x[i]) < flushThreshold ? Real(0) : x[i];
+    }
+}
+
+template <typename Real>
+ResonatorBankVecT<Real>::ResonatorBankVecT(size_t numResonators, const std::vector<Real> &frequencies, const std::vector<Real> &alphas, const std::vector<Real> &betas, Real sampleRate)
+: ResonatorBankVecT(numResonators, frequencies.data(), alphas.data(), betas.data(), sampleRate) {
+}
+
+template <typename Real>
+ResonatorBankVecT<Real>::ResonatorBankVecT(size_t numResonators, const Real* frequencies, const Real* alphas, const Real* betas, Real sampleRate)
+: ResonatorBankVecT(std::make_shared<ResonatorBankVecTablesT<Real>>(numResonators, frequencies, alphas, betas, sampleRate), nullptr) {
+    m_ownsTables = true;
+}
+
+template <typename Real>
+ResonatorBankVecT<Real>::ResonatorBankVecT(std::shared_ptr<const ResonatorBankVecTablesT<Real>> tables)
+: ResonatorBankVecT(std::move(tables), nullptr) {
+}
+
+template <typename Real>
+ResonatorBankVecT<Real>::ResonatorBankVecT(size_t numResonators, const Real* frequencies, const Real* alphas, const Real* betas, Real sampleRate,
+                                           Arena &arena)
+: ResonatorBankVecT(std::allocate_shared<ResonatorBankVecTablesT<Real>>(ArenaAllocator<ResonatorBankVecTablesT<Real>>(&arena),
+                                                                        numResonators, frequencies, alphas, betas, sampleRate, &arena),
+                    &arena) {
+    m_ownsTables = true;
+}
+
+/// State buffers allocated from arena, or from the bank's own block if arena is null
+template <typename Real>
+ResonatorBankVecT<Real>::ResonatorBankVecT(std::shared_ptr<const ResonatorBankVecTablesT<Real>> tables, Arena *arena)
+: m_sampleRate(tables->sampleRate), m_numResonators(tables->numResonators), m_tables(std::move(tables)), m_ownsTables(false),
+m_paddedNumResonators(m_tables->paddedNumResonators), m_stride(m_tables->stride),
+m_stateArena(arena ? 0 : stateSize(m_numResonators)),
+m_r(2 * m_stride, Real(0), ArenaAllocator<Real>(arena ? arena : &m_stateArena)),
+m_rr(2 * m_stride, Real(0), ArenaAllocator<Real>(arena ? arena : &m_stateArena)),
+m_z(2 * m_stride, Real(0), ArenaAllocator<Real>(arena ? arena : &m_stateArena)),
+m_phases(m_numResonators, Real(0), ArenaAllocator<Real>(arena ? arena : &m_stateArena)),
+m_kernels(&kernels<Real>(bestKernelVariant())), m_samplesSinceOutput(0), m_numShards(1),
+m_silenceThreshold(Real(0)),
+m_phasorResync(false), m_fixedResyncInterval(0), m_resyncInterval(defaultResyncInterval), m_samplesSinceResync(0),
+m_shardDrifts(1, Real(0), ArenaAllocator<Real>(arena ? arena : &m_stateArena)), m_snapshotVersion(0), m_batchBlockSize(0) {
+
+    // phasors start at 1
+    vops::fill(Real(1), m_z.data(), m_stride);
+}
+
+template <typename Real>
+size_t ResonatorBankVecT<Real>::stateSize(size_t numResonators) {
+    const size_t stride = (numResonators + resonatorAlignment - 1) / resonatorAlignment * resonatorAlignment;
+    return 3 * Arena::alignedSize(2 * stride * sizeof(Real))  // R, RR, Z
+        + Arena::alignedSize(numResonators * sizeof(Real))     // tracking phases
+        + Arena::alignedSize(sizeof(Real));                    // shard drifts
+}
+
+template <typename Real>
+size_t ResonatorBankVecT<Real>::arenaSize(size_t numResonators) {
+    return ResonatorBankVecTablesT<Real>::arenaSize(numResonators) + stateSize(numResonators);
+}
+
+template <typename Real>
+ResonatorBankVecTablesT<Real>::ResonatorBankVecTablesT(size_t numResonators, const Real* frequencies, const Real* alphas, const Real* betas, Real sampleRate,
+                                                       Arena *arena)
+: sampleRate(sampleRate), numResonators(numResonators),
+paddedNumResonators((numResonators + resonatorAlignment - 1) / resonatorAlignment * resonatorAlignment), stride(paddedNumResonators),
+frequencies(frequencies, frequencies + numResonators, ArenaAllocator<Real>(arena)),
+alphas(2 * stride, Real(0), ArenaAllocator<Real>(arena)), omAlphas(2 * stride, Real(0), ArenaAllocator<Real>(arena)),
+betas(2 * stride, Real(0), ArenaAllocator<Real>(arena)), omBetas(2 * stride, Real(0), ArenaAllocator<Real>(arena)),
+w(2 * stride, Real(0), ArenaAllocator<Real>(arena)), omegas(stride, 0.0, ArenaAllocator<double>(arena)),
+silenceJumps(silenceLevels * 5 * stride, Real(0), ArenaAllocator<Real>(arena)),
+precision(CoefficientPrecision::Float32), reducedCoefficients(ArenaAllocator<uint16_t>(arena)) {
+    // These are 2 * stride size, padding resonators with alpha = beta = 0
+    memcpy(this->alphas.data(), alphas, numResonators * sizeof(Real));
+    memcpy(this->alphas.data() + stride, alphas, numResonators * sizeof(Real));
+    vops::scalarMultiplyScalarAdd(this->alphas.data(), Real(-1), Real(1), omAlphas.data(), 2 * stride);
     
-    float twoPiOverSampleRate = twoPi / m_sampleRate;
-    m_w.resize(m_twoNumResonators);
-    vDSP_vfill(&twoPiOverSampleRate, m_w.data(), 1, m_twoNumResonators);
-
-    DSPSplitComplex W = {m_w.data(), m_w.data() + m_numResonators};
-    // multiply 2 * PI / sampleRate by frequency for each resonator
-    vDSP_vmul(W.realp, 1,
-              m_frequencies.data(), 1,
-              W.realp, 1,
-              m_numResonators);
-    vDSP_vmul(W.imagp, 1,
-              m_frequencies.data(), 1,
-              W.imagp, 1,
-              m_numResonators);
+    memcpy(this->betas.data(), betas, numResonators * sizeof(Real));
+    memcpy(this->betas.data() + stride, betas, numResonators * sizeof(Real));
+    vops::scalarMultiplyScalarAdd(this->betas.data(), Real(-1), Real(1), omBetas.data(), 2 * stride);
+
+    // multiply 2 * PI / sampleRate by frequency for each resonator (padding resonators at frequency 0)
+    Real *wReal = w.data();
+    Real *wImag = w.data() + stride;
+    vops::scalarMultiply(this->frequencies.data(), twoPiValue<Real> / sampleRate, wReal, numResonators);
+    memcpy(wImag, wReal, numResonators * sizeof(Real));
     
     // then calculate cos and sin
-    int count = static_cast<int>(m_numResonators);
-    vvcosf(W.realp, W.realp, &count);
-    vvsinf(W.imagp, W.imagp, &count);
-    
-    m_alphasSample.resize(m_twoNumResonators);
-    m_sm.resize(m_numResonators);
-    m_rsqrt.resize(m_numResonators);
+    vops::cos(wReal, wReal, stride);
+    vops::sin(wImag, wImag, stride);
+
+    for (size_t k=0; k<numResonators; ++k) {
+        omegas[k] = twoPiValue<double> * this->frequencies[k] / sampleRate;
+    }
+
+    for (size_t k=0; k<stride; ++k) {
+        setSilenceJumps(k);
+    }
+}
+
+/// Silence: jumps over L = 2^level zero samples. For resonator k, with a = 1-alpha, b = 1-beta:
+///   r_L  = a^L r0
+///   rr_L = b^L rr0 + K_L r0,   K_L = beta sum_{j=1..L} a^j b^(L-j)
+///   z_L  = z0 W^L
+/// Two jumps of L samples compose into one of 2L: a^2L = (a^L)^2, b^2L = (b^L)^2, K_2L = K_L (a^L + b^L), W^2L = (W^L)^2
+template <typename Real>
+void ResonatorBankVecTablesT<Real>::setSilenceJumps(size_t k) {
+    const size_t width = 5 * stride;
+    double aPower = omAlphas[k];
+    double bPower = omBetas[k];
+    double rToRR = betas[k] * omAlphas[k];
+    // unit phasor multiplier, at the angle of the one actually used by the update kernel
+    const double wNorm = std::hypot(static_cast<double>(w[k]), static_cast<double>(w[stride + k]));
+    double wRe = w[k] / wNorm;
+    double wIm = w[stride + k] / wNorm;
+    for (size_t level = 0; level < silenceLevels; ++level) {
+        Real *jump = silenceJumps.data() + level * width;
+        jump[k] = static_cast<Real>(aPower);
+        jump[stride + k] = static_cast<Real>(bPower);
+        jump[2 * stride + k] = static_cast<Real>(rToRR);
+        jump[3 * stride + k] = static_cast<Real>(wRe);
+        jump[4 * stride + k] = static_cast<Real>(wIm);
+        rToRR *= aPower + bPower;
+        aPower *= aPower;
+        bPower *= bPower;
+        const double re = wRe * wRe - wIm * wIm;
+        wIm = 2.0 * wRe * wIm;
+        wRe = re;
+    }
+}
+
+template <typename Real>
+void ResonatorBankVecTablesT<Real>::setResonator(size_t k, Real frequency, Real alpha, Real beta) {
+    if (k < numResonators) {
+        frequencies[k] = frequency;
+    }
+    alphas[k] = alphas[stride + k] = alpha;
+    omAlphas[k] = omAlphas[stride + k] = Real(1) - alpha;
+    betas[k] = betas[stride + k] = beta;
+    omBetas[k] = omBetas[stride + k] = Real(1) - beta;
+    const Real angle = frequency * (twoPiValue<Real> / sampleRate);
+    w[k] = std::cos(angle);
+    w[stride + k] = std::sin(angle);
+    omegas[k] = twoPiValue<double> * frequency / sampleRate;
+    setSilenceJumps(k);
+    if (precision != CoefficientPrecision::Float32) {
+        setReducedCoefficients(k);
+    }
+}
+
+template <typename Real>
+void ResonatorBankVecTablesT<Real>::setPrecision(CoefficientPrecision precision) {
+    this->precision = precision;
+    if (precision == CoefficientPrecision::Float32) {
+        reducedCoefficients.clear();
+        reducedCoefficients.shrink_to_fit();
+        return;
+    }
+    reducedCoefficients.resize(4 * stride);
+    for (size_t k=0; k<stride; ++k) {
+        setReducedCoefficients(k);
+    }
+}
+
+template <typename Real>
+void ResonatorBankVecTablesT<Real>::setReducedCoefficients(size_t k) {
+    const auto reduce = precision == CoefficientPrecision::Float16 ? floatToHalf : floatToBFloat16;
+    reducedCoefficients[k] = reduce(alphas[k]);
+    reducedCoefficients[stride + k] = reduce(betas[k]);
+    reducedCoefficients[2 * stride + k] = reduce(w[k]);
+    reducedCoefficients[3 * stride + k] = reduce(w[stride + k]);
+}
+
+template <typename Real>
+ReducedCoefficients ResonatorBankVecTablesT<Real>::reduced(size_t begin) const {
+    const uint16_t *values = reducedCoefficients.data() + begin;
+    return {precision, values, values + stride, values + 2 * stride};
+}
+
+template <typename Real>
+void ResonatorBankVecTablesT<Real>::kernelCoefficients(size_t k, Real &alpha, Real &beta, double &angle) const {
+    if (precision == CoefficientPrecision::Float32) {
+        alpha = alphas[k];
+        beta = betas[k];
+        angle = std::atan2(static_cast<double>(w[stride + k]), static_cast<double>(w[k]));
+        return;
+    }
+    // the kernels renormalize W, which does not change its angle
+    const auto widen = precision == CoefficientPrecision::Float16 ? halfToFloat : bfloat16ToFloat;
+    alpha = widen(reducedCoefficients[k]);
+    beta = widen(reducedCoefficients[stride + k]);
+    angle = std::atan2(static_cast<double>(widen(reducedCoefficients[3 * stride + k])),
+                       static_cast<double>(widen(reducedCoefficients[2 * stride + k])));
+}
+
+/// Move the count resonators of the numParts parts (stride values each) of a non-interlaced array
+/// to parts of newStride values, opening a gap at index (insert) or closing the gap of resonator index (remove).
+/// Vacated values are set to 0.
+template <typename T>
+static void moveResonators(AlignedVector<T> &values, size_t numParts, size_t stride, size_t newStride,
+                           size_t count, size_t index, bool insert) {
+    if (newStride != stride) {
+        AlignedVector<T> moved(numParts * newStride, T(0), values.get_allocator());
+        for (size_t part = 0; part < numParts; ++part) {
+            std::copy(values.data() + part * stride, values.data() + part * stride + count, moved.data() + part * newStride);
+        }
+        values.swap(moved);
+    }
+    for (size_t part = 0; part < numParts; ++part) {
+        T *v = values.data() + part * newStride;
+        if (insert) {
+            std::copy_backward(v + index, v + count, v + count + 1);
+            v[index] = T(0);
+        } else {
+            std::copy(v + index + 1, v + count, v + index);
+            v[count - 1] = T(0);
+        }
+    }
+}
+
+template <typename Real>
+void ResonatorBankVecTablesT<Real>::insertResonator(size_t index, Real frequency, Real alpha, Real beta) {
+    const size_t count = numResonators;
+    const size_t oldStride = stride;
+    const size_t newStride = count + 1 > stride ? std::max(2 * stride, resonatorAlignment) : stride;
+    for (AlignedVector<Real> *values : { &alphas, &omAlphas, &betas, &omBetas, &w }) {
+        moveResonators(*values, 2, oldStride, newStride, count, index, true);
+    }
+    moveResonators(omegas, 1, oldStride, newStride, count, index, true);
+    moveResonators(silenceJumps, 5 * silenceLevels, oldStride, newStride, count, index, true);
+    if (precision != CoefficientPrecision::Float32) {
+        moveResonators(reducedCoefficients, 4, oldStride, newStride, count, index, true);
+    }
+    frequencies.insert(frequencies.begin() + index, frequency);
+    numResonators = count + 1;
+    paddedNumResonators = (numResonators + resonatorAlignment - 1) / resonatorAlignment * resonatorAlignment;
+    stride = newStride;
+    // new padding resonators
+    for (size_t k = oldStride == newStride ? stride : numResonators; k < stride; ++k) {
+        setResonator(k, Real(0), Real(0), Real(0));
+    }
+    setResonator(index, frequency, alpha, beta);
+}
+
+template <typename Real>
+void ResonatorBankVecTablesT<Real>::removeResonator(size_t index) {
+    const size_t count = numResonators;
+    for (AlignedVector<Real> *values : { &alphas, &omAlphas, &betas, &omBetas, &w }) {
+        moveResonators(*values, 2, stride, stride, count, index, false);
+    }
+    moveResonators(omegas, 1, stride, stride, count, index, false);
+    moveResonators(silenceJumps, 5 * silenceLevels, stride, stride, count, index, false);
+    if (precision != CoefficientPrecision::Float32) {
+        moveResonators(reducedCoefficients, 4, stride, stride, count, index, false);
+    }
+    frequencies.erase(frequencies.begin() + index);
+    numResonators = count - 1;
+    paddedNumResonators = (numResonators + resonatorAlignment - 1) / resonatorAlignment * resonatorAlignment;
+    setResonator(numResonators, Real(0), Real(0), Real(0));
+}
+
+template <typename Real>
+size_t ResonatorBankVecTablesT<Real>::arenaSize(size_t numResonators) {
+    const size_t stride = (numResonators + resonatorAlignment - 1) / resonatorAlignment * resonatorAlignment;
+    // object and shared pointer control block
+    return Arena::alignedSize(sizeof(ResonatorBankVecTablesT<Real>) + 2 * arenaAlignment)
+        + Arena::alignedSize(numResonators * sizeof(Real))         // frequencies
+        + 5 * Arena::alignedSize(2 * stride * sizeof(Real))        // alphas, omAlphas, betas, omBetas, w
+        + Arena::alignedSize(stride * sizeof(double))               // omegas
+        + Arena::alignedSize(silenceLevels * 5 * stride * sizeof(Real));
+}
+
+template <typename Real>
+void ResonatorBankVecT<Real>::setKernelVariant(KernelVariant variant) {
+    m_kernels = &kernels<Real>(variant);
 }
 
-float ResonatorBankVec::frequencyValue(size_t index) {
+template <typename Real>
+void ResonatorBankVecT<Real>::setCoefficientPrecision(CoefficientPrecision precision) {
+    if (precision != m_tables->precision) {
+        mutableTables().setPrecision(precision);
+        if (m_batchBlockSize) {
+            prepareBatch(m_batchBlockSize);
+        }
+    }
+}
+
+template <typename Real>
+CoefficientPrecisionReport ResonatorBankVecT<Real>::precisionReport(CoefficientPrecision precision, const Real *samples, size_t numSamples, size_t hop) const {
+    if (hop == 0) {
+        OSCILLATORS_THROW(std::invalid_argument("Bad hop passed to precisionReport()"));
+    }
+    auto floatTables = std::make_shared<ResonatorBankVecTablesT<Real>>(*m_tables);
+    floatTables->setPrecision(CoefficientPrecision::Float32);
+    auto reducedTables = std::make_shared<ResonatorBankVecTablesT<Real>>(*floatTables);
+    reducedTables->setPrecision(precision);
+
+    CoefficientPrecisionReport report = {};
+    const size_t n = m_numResonators;
+    const size_t stride = m_stride;
+    if (precision != CoefficientPrecision::Float32) {
+        const auto widen = precision == CoefficientPrecision::Float16 ? halfToFloat : bfloat16ToFloat;
+        const uint16_t *reduced = reducedTables->reducedCoefficients.data();
+        for (size_t k=0; k<n; ++k) {
+            // frequencies of the phasor multipliers (the kernels renormalize W)
+            const double angle = std::atan2(static_cast<double>(floatTables->w[stride + k]), static_cast<double>(floatTables->w[k]));
+            const double reducedAngle = std::atan2(static_cast<double>(widen(reduced[3 * stride + k])), static_cast<double>(widen(reduced[2 * stride + k])));
+            const float frequencyError = static_cast<float>(std::fabs(reducedAngle - angle) * m_sampleRate / twoPiValue<double>);
+            report.maxFrequencyError = std::max(report.maxFrequencyError, frequencyError);
+            if (floatTables->frequencies[k] > Real(0)) {
+                report.maxRelativeFrequencyError = std::max(report.maxRelativeFrequencyError,
+                                                            static_cast<float>(frequencyError / floatTables->frequencies[k]));
+            }
+            const Real alpha = floatTables->alphas[k];
+            const Real beta = floatTables->betas[k];
+            if (alpha > Real(0)) {
+                report.maxAlphaError = std::max(report.maxAlphaError, static_cast<float>(std::fabs(widen(reduced[k]) - alpha) / alpha));
+            }
+            if (beta > Real(0)) {
+                report.maxBetaError = std::max(report.maxBetaError, static_cast<float>(std::fabs(widen(reduced[stride + k]) - beta) / beta));
+            }
+        }
+    }
+
+    ResonatorBankVecT floatBank(floatTables);
+    ResonatorBankVecT reducedBank(reducedTables);
+    floatBank.setKernelVariant(kernelVariant());
+    reducedBank.setKernelVariant(kernelVariant());
+    std::vector<Real> powers(n);
+    std::vector<Real> reducedPowers(n);
+    double sum = 0.0;
+    size_t count = 0;
+    for (size_t first = 0; first < numSamples; first += hop) {
+        const size_t length = std::min(hop, numSamples - first);
+        floatBank.update(samples + first, length, 1);
+        reducedBank.update(samples + first, length, 1);
+        floatBank.getPowers(powers.data(), n);
+        reducedBank.getPowers(reducedPowers.data(), n);
+        const Real maxPower = *std::max_element(powers.begin(), powers.end());
+        if (!(maxPower > Real(0))) {
+            continue;
+        }
+        for (size_t k=0; k<n; ++k) {
+            const float error = static_cast<float>(std::fabs(reducedPowers[k] - powers[k]) / maxPower);
+            report.maxPowerError = std::max(report.maxPowerError, error);
+            sum += error;
+        }
+        count += n;
+    }
+    report.meanPowerError = count ? static_cast<float>(sum / static_cast<double>(count)) : 0.0f;
+    return report;
+}
+
+template <typename Real>
+Real ResonatorBankVecT<Real>::frequencyValue(size_t index) {
+    if (index >= m_numResonators) {
+        OSCILLATORS_THROW(std::out_of_range("Bad index passed to frequencyValue()"));
+    }
+    return m_tables->frequencies[index];
+}
+
+template <typename Real>
+Real ResonatorBankVecT<Real>::alphaValue(size_t index) {
+    if (index >= m_numResonators) {
+        OSCILLATORS_THROW(std::out_of_range("Bad index passed to alphaValue()"));
+    }
+    return m_tables->alphas[index];
+}
+
+template <typename Real>
+void ResonatorBankVecT<Real>::setAllAlphas(Real alpha) {
+    ResonatorBankVecTablesT<Real> &tables = mutableTables();
+    for (size_t k=0; k<m_numResonators; ++k) {
+        tables.setResonator(k, tables.frequencies[k], alpha, tables.betas[k]);
+    }
+    if (m_batchBlockSize) {
+        prepareBatch(m_batchBlockSize);
+    }
+}
+
+template <typename Real>
+Real ResonatorBankVecT<Real>::betaValue(size_t index) {
     if (index >= m_numResonators) {
-        throw std::out_of_range("Bad index passed to frequencyValue()");
+        OSCILLATORS_THROW(std::out_of_range("Bad index passed to betaValue()"));
     }
-    return m_frequencies[index];
+    return m_tables->betas[index];
 }
 
-float ResonatorBankVec::alphaValue(size_t index) {
+template <typename Real>
+Real ResonatorBankVecT<Real>::phaseValue(size_t index) {
     if (index >= m_numResonators) {
-        throw std::out_of_range("Bad index passed to alphaValue()");
+        OSCILLATORS_THROW(std::out_of_range("Bad index passed to phaseValue()"));
     }
-    return m_alphas[index];
+    return m_phases[index];
 }
 
-float ResonatorBankVec::betaValue(size_t index) {
+template <typename Real>
+ResonatorBankVecTablesT<Real>& ResonatorBankVecT<Real>::mutableTables() {
+    if (!m_ownsTables || m_tables.use_count() > 1) {
+        m_tables = std::make_shared<ResonatorBankVecTablesT<Real>>(*m_tables);
+        m_ownsTables = true;
+    }
+    return const_cast<ResonatorBankVecTablesT<Real>&>(*m_tables);
+}
+
+template <typename Real>
+void ResonatorBankVecT<Real>::setFrequency(size_t index, Real frequency) {
     if (index >= m_numResonators) {
-        throw std::out_of_range("Bad index passed to alphaValue()");
+        OSCILLATORS_THROW(std::out_of_range("Bad index passed to setFrequency()"));
+    }
+    ResonatorBankVecTablesT<Real> &tables = mutableTables();
+    tables.setResonator(index, frequency, tables.alphas[index], tables.betas[index]);
+    if (m_phasorResync) {
+        // phase at the last resync that the new frequency carries to the current phase
+        m_resyncPhases[index] = std::atan2(static_cast<double>(m_z[m_stride + index]), static_cast<double>(m_z[index]))
+            - tables.omegas[index] * static_cast<double>(m_samplesSinceResync);
+    }
+    if (m_batchBlockSize) {
+        prepareBatchResonator(index);
+    }
+}
+
+template <typename Real>
+void ResonatorBankVecT<Real>::setAlpha(size_t index, Real alpha) {
+    if (index >= m_numResonators) {
+        OSCILLATORS_THROW(std::out_of_range("Bad index passed to setAlpha()"));
+    }
+    ResonatorBankVecTablesT<Real> &tables = mutableTables();
+    tables.setResonator(index, tables.frequencies[index], alpha, tables.betas[index]);
+    if (m_batchBlockSize) {
+        prepareBatchResonator(index);
     }
-    return m_alphas[index];
 }
 
-void ResonatorBankVec::getPowers(float *dest, size_t size) {
+template <typename Real>
+void ResonatorBankVecT<Real>::setBeta(size_t index, Real beta) {
+    if (index >= m_numResonators) {
+        OSCILLATORS_THROW(std::out_of_range("Bad index passed to setBeta()"));
+    }
+    ResonatorBankVecTablesT<Real> &tables = mutableTables();
+    tables.setResonator(index, tables.frequencies[index], tables.alphas[index], beta);
+    if (m_batchBlockSize) {
+        prepareBatchResonator(index);
+    }
+}
+
+template <typename Real>
+void ResonatorBankVecT<Real>::insertResonator(size_t index, Real frequency, Real alpha, Real beta) {
+    if (index > m_numResonators) {
+        OSCILLATORS_THROW(std::out_of_range("Bad index passed to insertResonator()"));
+    }
+    ResonatorBankVecTablesT<Real> &tables = mutableTables();
+    const size_t count = m_numResonators;
+    tables.insertResonator(index, frequency, alpha, beta);
+    for (AlignedVector<Real> *values : { &m_r, &m_rr, &m_z }) {
+        moveResonators(*values, 2, m_stride, tables.stride, count, index, true);
+    }
+    m_phases.insert(m_phases.begin() + index, Real(0));
+    // phasors of the new resonator and of new padding resonators start at 1
+    for (size_t k = count + 1; k < tables.stride; ++k) {
+        m_z[k] = Real(1);
+    }
+    m_z[index] = Real(1);
+    resonatorsChanged(index);
+}
+
+template <typename Real>
+void ResonatorBankVecT<Real>::removeResonator(size_t index) {
+    if (index >= m_numResonators) {
+        OSCILLATORS_THROW(std::out_of_range("Bad index passed to removeResonator()"));
+    }
+    ResonatorBankVecTablesT<Real> &tables = mutableTables();
+    const size_t count = m_numResonators;
+    tables.removeResonator(index);
+    for (AlignedVector<Real> *values : { &m_r, &m_rr, &m_z }) {
+        moveResonators(*values, 2, m_stride, m_stride, count, index, false);
+    }
+    m_phases.erase(m_phases.begin() + index);
+    // the vacated resonator is padding
+    m_z[count - 1] = Real(1);
+    resonatorsChanged(index);
+}
+
+/// Follow a change in the number of resonators (or capacity), from index
+template <typename Real>
+void ResonatorBankVecT<Real>::resonatorsChanged(size_t index) {
+    m_numResonators = m_tables->numResonators;
+    m_paddedNumResonators = m_tables->paddedNumResonators;
+    const size_t oldStride = m_stride;
+    m_stride = m_tables->stride;
+    setNumShards();
+    if (m_phasorResync) {
+        // the phase counter restarts from the current phasors of the moved resonators
+        m_resyncPhases.resize(m_stride);
+        m_resyncPhasors.resize(2 * m_stride);
+        for (size_t k=(oldStride == m_stride ? index : 0); k<m_paddedNumResonators; ++k) {
+            m_resyncPhases[k] = std::atan2(static_cast<double>(m_z[m_stride + k]), static_cast<double>(m_z[k]))
+                - m_tables->omegas[k] * static_cast<double>(m_samplesSinceResync);
+        }
+    }
+    if (m_snapshot) {
+        m_snapshot = std::make_unique<Snapshot>(3, m_numResonators);
+        m_snapshotValues.resize(3 * m_numResonators);
+        m_publishedValues.resize(std::is_same<Real, float>::value ? 0 : 3 * m_numResonators);
+    }
+    if (m_batchBlockSize) {
+        prepareBatch(m_batchBlockSize);
+    }
+}
+
+template <typename Real>
+void ResonatorBankVecT<Real>::getPowers(Real *dest, size_t size) {
     if (size < m_numResonators)
     {
-        throw std::out_of_range("Buffer passed to getPowers() is not large enough");
+        OSCILLATORS_THROW(std::out_of_range("Buffer passed to getPowers() is not large enough"));
     }
-    DSPSplitComplex R = {m_rr.data(), m_rr.data() + m_numResonators};
-    vDSP_zvmags(&R, 1, dest, 1, m_numResonators);
+    m_kernels->powers(m_numResonators, m_stride, m_rr.data(), dest);
 }
 
-void ResonatorBankVec::getAmplitudes(float *dest, size_t size) {
+template <typename Real>
+void ResonatorBankVecT<Real>::getAmplitudes(Real *dest, size_t size) {
     if (size < m_numResonators)
     {
-        throw std::out_of_range("Buffer passed to getAmplitudes() is not large enough");
-    }
-    DSPSplitComplex R = {m_rr.data(), m_rr.data() + m_numResonators};
-    vDSP_zvmags(&R, 1, dest, 1, m_numResonators);
-    int count = static_cast<int>(m_numResonators);
-    vvsqrtf(dest, dest, &count);
-}
-
-void ResonatorBankVec::update(const float sample) {
-    vDSP_vsmul(m_alphas.data(), 1, &sample, m_alphasSample.data(), 1, m_twoNumResonators);
-        
-    // resonator
-    vDSP_vmma(m_r.data(), 1,
-              m_omAlphas.data(), 1,
-              m_z.data(), 1,
-              m_alphasSample.data(), 1,
-              m_r.data(), 1,
-              m_twoNumResonators);
-
-    // Smoothing with betas
-    vDSP_vmma(m_rr.data(), 1,
-              m_omBetas.data(), 1,
-              m_r.data(), 1,
-              m_betas.data(), 1,
-              m_rr.data(), 1,
-              m_twoNumResonators);
- 
-    // phasor
-    DSPSplitComplex Z = {m_z.data(), m_z.data() + m_numResonators};
-    DSPSplitComplex W = {m_w.data(), m_w.data() + m_numResonators};
-    vDSP_zvmul(&Z, 1,
-               &W, 1,
-               &Z, 1,
-               m_numResonators,
-               1);
-}
-
-void ResonatorBankVec::update(const std::vector<float> &samples) {
-    for (float sample : samples) {
-        update(sample);
-    }
-    stabilize(); // this is overkill but necessary
-}
-
-/// Process a frame of samples.
+        OSCILLATORS_THROW(std::out_of_range("Buffer passed to getAmplitudes() is not large enough"));
+    }
+    m_kernels->amplitudes(m_numResonators, m_stride, m_rr.data(), dest);
+}
+
+template <typename Real>
+void ResonatorBankVecT<Real>::update(const Real sample) noexcept {
+    runUpdateKernel(0, m_paddedNumResonators, &sample, 1, 1);
+    if (m_phasorResync) {
+        normalizePhasors(1);
+    }
+}
+
+template <typename Real>
+void ResonatorBankVecT<Real>::update(const std::vector<Real> &samples) noexcept {
+    update(samples.data(), samples.size(), 1);
+}
+
+/// Process a frame of samples with the fused kernel, jumping over silent runs
 /// Apply stabilization (norm correction) at the end
-/// Compute amplitudes (phasor magnitudes) at the end
-void ResonatorBankVec::update(const float *frameData, size_t frameLength, size_t sampleStride) {
-    for (int i=0; i<frameLength; i += sampleStride) {
-        update(frameData[i]);
+template <typename Real>
+void ResonatorBankVecT<Real>::update(const Real *frameData, size_t frameLength, size_t sampleStride) noexcept {
+    const size_t numSamples = (frameLength + sampleStride - 1) / sampleStride;
+    updateRange(0, m_paddedNumResonators, frameData, frameLength, sampleStride);
+    normalizePhasors(numSamples); // this is overkill but necessary
+    publishSnapshot();
+}
+
+/// Process a frame of integer PCM samples, converted to float in chunks that stay in L1 cache
+template <typename Real>
+void ResonatorBankVecT<Real>::update(const void *pcmData, PCMFormat format, size_t frameLength, size_t sampleStride, float scale) noexcept {
+    const size_t numSamples = (frameLength + sampleStride - 1) / sampleStride;
+    const uint8_t *data = static_cast<const uint8_t*>(pcmData);
+    const size_t step = sampleStride * pcmSampleSize(format);
+    float samples[pcmChunkSize];
+    // widened for double precision samples
+    Real realSamples[std::is_same<Real, float>::value ? 1 : pcmChunkSize];
+    for (size_t first = 0; first < numSamples; first += pcmChunkSize) {
+        const size_t count = std::min(pcmChunkSize, numSamples - first);
+        convertPCM(data + first * step, format, count, sampleStride, scale, samples);
+        const Real *chunk;
+        if constexpr (std::is_same<Real, float>::value) {
+            chunk = samples;
+        } else {
+            std::copy(samples, samples + count, realSamples);
+            chunk = realSamples;
+        }
+        updateRange(0, m_paddedNumResonators, chunk, count, 1);
     }
-    stabilize(); // this is overkill but necessary
+    normalizePhasors(numSamples); // this is overkill but necessary
+    publishSnapshot();
 }
 
-/// Process a frame of samples.
+/// Process a frame of samples for resonators [begin, begin+count) (padding included): runs of at least
+/// minSilentRun silent samples are skipped in closed form, the samples in between are processed by the update kernel.
+/// Flush tiny values at the end (the phasors are normalized by the caller).
+template <typename Real>
+void ResonatorBankVecT<Real>::updateRange(size_t begin, size_t count, const Real *frameData, size_t frameLength, size_t sampleStride) noexcept {
+    const size_t n = m_stride;
+    const size_t numSamples = (frameLength + sampleStride - 1) / sampleStride;
+    auto runKernel = [&](size_t first, size_t last) {
+        runUpdateKernel(begin, count, frameData + first * sampleStride,
+                        std::min(frameLength, last * sampleStride) - first * sampleStride, sampleStride);
+    };
+
+    size_t pending = 0; // first sample not processed yet
+    size_t s = 0;
+    while (s < numSamples) {
+        if (std::fabs(frameData[s * sampleStride]) > m_silenceThreshold) {
+            ++s;
+            continue;
+        }
+        size_t end = s + 1;
+        while (end < numSamples && std::fabs(frameData[end * sampleStride]) <= m_silenceThreshold) {
+            ++end;
+        }
+        if (end - s >= minSilentRun) {
+            if (s > pending) {
+                runKernel(pending, s);
+            }
+            skipSilence(begin, count, end - s);
+            pending = end;
+        }
+        s = end;
+    }
+    if (pending < numSamples) {
+        runKernel(pending, numSamples);
+    }
+
+    flushTiny(m_r.data() + begin, count);
+    flushTiny(m_r.data() + n + begin, count);
+    flushTiny(m_rr.data() + begin, count);
+    flushTiny(m_rr.data() + n + begin, count);
+}
+
+template <typename Real>
+void ResonatorBankVecT<Real>::runUpdateKernel(size_t begin, size_t count, const Real *frameData, size_t frameLength, size_t sampleStride) noexcept {
+    const ResonatorBankVecTablesT<Real> &tables = *m_tables;
+    if (tables.precision != CoefficientPrecision::Float32) {
+        m_kernels->updateReduced(count, m_stride, m_r.data() + begin, m_rr.data() + begin, m_z.data() + begin, tables.reduced(begin),
+                                 frameData, frameLength, sampleStride);
+        return;
+    }
+    m_kernels->update(count, m_stride,
+                      m_r.data() + begin, m_rr.data() + begin, m_z.data() + begin, tables.w.data() + begin,
+                      tables.alphas.data() + begin, tables.omAlphas.data() + begin, tables.betas.data() + begin, tables.omBetas.data() + begin,
+                      frameData, frameLength, sampleStride);
+}
+
+template <typename Real>
+void ResonatorBankVecT<Real>::setSilenceThreshold(Real threshold) {
+    if (!(threshold >= Real(0))) {
+        OSCILLATORS_THROW(std::invalid_argument("Bad threshold passed to setSilenceThreshold()"));
+    }
+    m_silenceThreshold = threshold;
+}
+
+/// Advance the state of resonators [begin, begin+count) over numSamples silent samples,
+/// composing the precomputed jumps for the binary decomposition of numSamples
+/// (in runs of at most 2^silenceLevels - 1 samples)
+template <typename Real>
+void ResonatorBankVecT<Real>::skipSilence(size_t begin, size_t count, size_t numSamples) noexcept {
+    constexpr size_t maxRun = (size_t(1) << ResonatorBankVecTablesT<Real>::silenceLevels) - 1;
+    const size_t n = m_stride;
+    Real *rRe = m_r.data() + begin;
+    Real *rIm = m_r.data() + n + begin;
+    Real *rrRe = m_rr.data() + begin;
+    Real *rrIm = m_rr.data() + n + begin;
+    Real *zRe = m_z.data() + begin;
+    Real *zIm = m_z.data() + n + begin;
+    const Real *jumps = m_tables->silenceJumps.data();
+    while (numSamples != 0) {
+        const size_t run = std::min(numSamples, maxRun);
+        numSamples -= run;
+        for (size_t level = 0, remaining = run; remaining != 0; ++level, remaining >>= 1) {
+            if ((remaining & 1) == 0) {
+                continue;
+            }
+            const Real *jump = jumps + level * 5 * n + begin;
+            const Real *omAlphasL = jump;
+            const Real *omBetasL = jump + n;
+            const Real *rToRR = jump + 2 * n;
+            const Real *wlRe = jump + 3 * n;
+            const Real *wlIm = jump + 4 * n;
+            OSCILLATORS_VECTORIZE
+            for (size_t k=0; k<count; ++k) {
+                rrRe[k] = omBetasL[k] * rrRe[k] + rToRR[k] * rRe[k];
+                rrIm[k] = omBetasL[k] * rrIm[k] + rToRR[k] * rIm[k];
+                rRe[k] = omAlphasL[k] * rRe[k];
+                rIm[k] = omAlphasL[k] * rIm[k];
+                const Real zr = zRe[k] * wlRe[k] - zIm[k] * wlIm[k];
+                const Real zi = zRe[k] * wlIm[k] + zIm[k] * wlRe[k];
+                zRe[k] = zr;
+                zIm[k] = zi;
+            }
+        }
+    }
+}
+
+/// Process a frame of samples, writing the powers and/or amplitudes after every sample
+/// Apply stabilization (norm correction) at the end
+template <typename Real>
+size_t ResonatorBankVecT<Real>::update(const Real *frameData, size_t frameLength, size_t sampleStride, Real* powers, Real* amplitudes) {
+    return update(frameData, frameLength, sampleStride, 1, powers, amplitudes);
+}
+
+/// Process a frame of samples, writing the powers and/or amplitudes every outputInterval samples,
+/// counted across frames (fused in the update kernel).
+/// As in updateRange, runs of at least minSilentRun silent samples are skipped in closed form (when outputs are at
+/// least minSilentRun samples apart: each output within a run is computed after a jump), and tiny values are flushed.
 /// Apply stabilization (norm correction) at the end
-/// Compute amplitudes (phasor magnitudes) at the end
-void ResonatorBankVec::update(const float *frameData, size_t frameLength, size_t sampleStride, float* powers, float* amplitudes) {
-    for (int i=0; i<frameLength; i += sampleStride) {
-        update(frameData[i]);
+template <typename Real>
+size_t ResonatorBankVecT<Real>::update(const Real *frameData, size_t frameLength, size_t sampleStride, size_t outputInterval, Real* powers, Real* amplitudes) {
+    if (outputInterval == 0) {
+        OSCILLATORS_THROW(std::invalid_argument("Bad outputInterval passed to update()"));
+    }
+    if (m_samplesSinceOutput >= outputInterval) {
+        m_samplesSinceOutput = 0;
+    }
+    const size_t n = m_stride;
+    // the output rows only hold the resonators of the bank (the padding resonators have neutral coefficients)
+    const size_t count = m_numResonators;
+    const size_t numSamples = (frameLength + sampleStride - 1) / sampleStride;
+    const size_t numRows = (m_samplesSinceOutput + numSamples) / outputInterval;
+    const ResonatorBankVecTablesT<Real> &tables = *m_tables;
+
+    size_t countdown = outputInterval - m_samplesSinceOutput; // samples up to the next output
+    size_t row = 0; // next output row
+    auto runKernel = [&](size_t first, size_t last) {
+        const Real *data = frameData + first * sampleStride;
+        const size_t length = std::min(frameLength, last * sampleStride) - first * sampleStride;
+        Real *rowPowers = powers ? powers + row * count : nullptr;
+        Real *rowAmplitudes = amplitudes ? amplitudes + row * count : nullptr;
+        if (tables.precision != CoefficientPrecision::Float32) {
+            m_kernels->updateOutputReduced(count, n, m_r.data(), m_rr.data(), m_z.data(), tables.reduced(0),
+                                           data, length, sampleStride,
+                                           outputInterval, countdown, rowPowers, rowAmplitudes, count);
+        } else {
+            m_kernels->updateOutput(count, n,
+                                    m_r.data(), m_rr.data(), m_z.data(), tables.w.data(),
+                                    tables.alphas.data(), tables.omAlphas.data(), tables.betas.data(), tables.omBetas.data(),
+                                    data, length, sampleStride,
+                                    outputInterval, countdown, rowPowers, rowAmplitudes, count);
+        }
+        const size_t runLength = last - first;
+        if (runLength < countdown) {
+            countdown -= runLength;
+        } else {
+            row += (runLength - countdown) / outputInterval + 1;
+            countdown = outputInterval - (runLength - countdown) % outputInterval;
+        }
+    };
+    auto skipRun = [&](size_t runLength) {
+        while (runLength != 0) {
+            const size_t jump = std::min(runLength, countdown);
+            skipSilence(0, count, jump);
+            runLength -= jump;
+            countdown -= jump;
+            if (countdown == 0) {
+                if (powers) {
+                    m_kernels->powers(count, n, m_rr.data(), powers + row * count);
+                }
+                if (amplitudes) {
+                    m_kernels->amplitudes(count, n, m_rr.data(), amplitudes + row * count);
+                }
+                ++row;
+                countdown = outputInterval;
+            }
+        }
+    };
+
+    size_t pending = 0; // first sample not processed yet
+    size_t s = 0;
+    while (s < numSamples) {
+        if (std::fabs(frameData[s * sampleStride]) > m_silenceThreshold) {
+            ++s;
+            continue;
+        }
+        size_t end = s + 1;
+        while (end < numSamples && std::fabs(frameData[end * sampleStride]) <= m_silenceThreshold) {
+            ++end;
+        }
+        if (end - s >= minSilentRun && outputInterval >= minSilentRun) {
+            if (s > pending) {
+                runKernel(pending, s);
+            }
+            skipRun(end - s);
+            pending = end;
+        }
+        s = end;
     }
-    stabilize(); // this is overkill but necessary
+    if (pending < numSamples) {
+        runKernel(pending, numSamples);
+    }
+
+    flushTiny(m_r.data(), count);
+    flushTiny(m_r.data() + n, count);
+    flushTiny(m_rr.data(), count);
+    flushTiny(m_rr.data() + n, count);
+
+    m_samplesSinceOutput = outputInterval - countdown;
+    normalizePhasors(numSamples); // this is overkill but necessary
+    publishSnapshot();
+    return numRows;
+}
+
+/// Process a frame of samples, then track frequencies from the phase drift of RR over the frame
+/// (vectorized equivalent of Resonator::updateAndTrack() for each resonator, in a single pass over RR)
+template <typename Real>
+void ResonatorBankVecT<Real>::updateAndTrack(const Real *frameData, size_t frameLength, size_t sampleStride, Real *trackedFrequencies) noexcept {
+    update(frameData, frameLength, sampleStride);
+    const size_t numSamples = (frameLength + sampleStride - 1) / sampleStride;
+    if (numSamples == 0) {
+        std::copy(m_tables->frequencies.begin(), m_tables->frequencies.end(), trackedFrequencies);
+        return;
+    }
+    m_kernels->track(m_numResonators, m_stride, m_rr.data(), m_tables->frequencies.data(),
+                     trackFrequencyThreshold * trackFrequencyThreshold, m_sampleRate / (twoPiValue<Real> * static_cast<Real>(numSamples)),
+                     m_phases.data(), trackedFrequencies);
 }
 
 /// Apply norm correction to phasor.
 /// This can be done every few hundreds (?) of iterations
-void ResonatorBankVec::stabilize() {
-    DSPSplitComplex Z = {m_z.data(), m_z.data() + m_numResonators};
-    vDSP_zvmags(&Z, 1, m_sm.data(), 1, m_numResonators);
-    // use reciprocal square root
-    int count = static_cast<int>(m_numResonators);
-    vvrsqrtf(m_rsqrt.data(), m_sm.data(), &count);
-    vDSP_zrvmul(&Z, 1, m_rsqrt.data(), 1, &Z, 1, m_numResonators);
+template <typename Real>
+void ResonatorBankVecT<Real>::stabilize() noexcept {
+    m_kernels->stabilize(m_paddedNumResonators, m_stride, m_z.data());
+}
+
+template <typename Real>
+void ResonatorBankVecT<Real>::setPhasorResync(bool enabled, size_t resyncInterval) {
+    m_phasorResync = enabled;
+    m_fixedResyncInterval = resyncInterval;
+    m_resyncInterval = resyncInterval ? resyncInterval : defaultResyncInterval;
+    m_samplesSinceResync = 0;
+    // start counting from the current phasors
+    m_resyncPhases.resize(m_stride);
+    m_resyncPhasors.resize(2 * m_stride);
+    for (size_t k=0; k<m_paddedNumResonators; ++k) {
+        m_resyncPhases[k] = std::atan2(static_cast<double>(m_z[m_stride + k]), static_cast<double>(m_z[k]));
+    }
 }
+
+/// Normalize the phasors of the whole bank at the end of a frame of numSamples samples
+template <typename Real>
+void ResonatorBankVecT<Real>::normalizePhasors(size_t numSamples) noexcept {
+    const Real drift = normalizePhasorRange(0, m_paddedNumResonators, numSamples);
+    advancePhaseCounter(numSamples, drift);
+}
+
+/// Normalize the phasors of resonators [begin, begin+count) at the end of a frame of numSamples samples:
+/// stabilize them, or in resync mode, if the resync is due, reset them to their exact values.
+/// Returns the drift corrected by the resync (0 if none).
+/// Only reads the phase counter, so that shards can run concurrently (see advancePhaseCounter()).
+template <typename Real>
+Real ResonatorBankVecT<Real>::normalizePhasorRange(size_t begin, size_t count, size_t numSamples) noexcept {
+    const size_t n = m_stride;
+    if (!m_phasorResync) {
+        m_kernels->stabilize(count, n, m_z.data() + begin);
+        return Real(0);
+    }
+    const size_t elapsed = m_samplesSinceResync + numSamples;
+    if (elapsed < m_resyncInterval) {
+        return Real(0);
+    }
+    // exact phases, wrapped to [-PI, PI) in double precision
+    const double length = static_cast<double>(elapsed);
+    Real *exactRe = m_resyncPhasors.data() + begin;
+    Real *exactIm = m_resyncPhasors.data() + n + begin;
+    for (size_t k=begin; k<begin+count; ++k) {
+        double phase = m_resyncPhases[k] + m_tables->omegas[k] * length;
+        phase -= twoPiValue<double> * std::floor(phase / twoPiValue<double> + 0.5);
+        m_resyncPhases[k] = phase;
+        exactRe[k - begin] = static_cast<Real>(phase);
+    }
+    memcpy(exactIm, exactRe, count * sizeof(Real));
+    vops::cos(exactRe, exactRe, count);
+    vops::sin(exactIm, exactIm, count);
+
+    Real *zRe = m_z.data() + begin;
+    Real *zIm = m_z.data() + n + begin;
+    Real drift = Real(0);
+    OSCILLATORS_VECTORIZE
+    for (size_t k=0; k<count; ++k) {
+        const Real dRe = zRe[k] - exactRe[k];
+        const Real dIm = zIm[k] - exactIm[k];
+        drift = std::max(drift, dRe * dRe + dIm * dIm);
+        zRe[k] = exactRe[k];
+        zIm[k] = exactIm[k];
+    }
+    return std::sqrt(drift);
+}
+
+/// Advance the phase counter by numSamples, once all the phasors of the bank have been normalized.
+/// After a resync, adapt the interval to the drift (largest over the bank) if it is not fixed.
+template <typename Real>
+void ResonatorBankVecT<Real>::advancePhaseCounter(size_t numSamples, Real drift) noexcept {
+    if (!m_phasorResync) {
+        return;
+    }
+    m_samplesSinceResync += numSamples;
+    if (m_samplesSinceResync < m_resyncInterval) {
+        return;
+    }
+    m_samplesSinceResync = 0;
+    if (m_fixedResyncInterval == 0) {
+        if (drift > resyncDriftTarget) {
+            m_resyncInterval = std::max(minResyncInterval, m_resyncInterval / 2);
+        } else if (drift < 0.5f * resyncDriftTarget) {
+            m_resyncInterval = std::min(maxResyncInterval, m_resyncInterval * 2);
+        }
+    }
+}
+
+template <typename Real>
+void ResonatorBankVecT<Real>::setNumThreads(size_t numThreads, bool pinThreads) {
+    if (numThreads == 0) {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    m_threadPool.reset();
+    if (numThreads > 1) {
+        m_threadPool = std::make_unique<ThreadPool>(numThreads, pinThreads);
+    }
+    setNumShards();
+}
+
+/// Enough shards to bound their size, rounded up to a multiple of the number of threads for balance
+template <typename Real>
+void ResonatorBankVecT<Real>::setNumShards() {
+    const size_t numThreads = this->numThreads();
+    const size_t minShards = (m_numResonators + maxShardSize - 1) / maxShardSize;
+    m_numShards = std::max(size_t(1), (minShards + numThreads - 1) / numThreads * numThreads);
+    m_shardDrifts.assign(m_numShards, Real(0));
+}
+
+template <typename Real>
+size_t ResonatorBankVecT<Real>::shardBegin(size_t shard) const {
+    if (shard >= m_numShards) {
+        return m_paddedNumResonators; // the last shard also updates the padding
+    }
+    return (shard * m_numResonators / m_numShards) / shardAlignment * shardAlignment;
+}
+
+template <typename Real>
+void ResonatorBankVecT<Real>::updateShard(size_t shard, const Real *frameData, size_t frameLength, size_t sampleStride, Real *powers) {
+    const size_t begin = shardBegin(shard);
+    const size_t count = shardBegin(shard + 1) - begin;
+    if (count == 0) {
+        return;
+    }
+    updateRange(begin, count, frameData, frameLength, sampleStride);
+    m_shardDrifts[shard] = normalizePhasorRange(begin, count, (frameLength + sampleStride - 1) / sampleStride);
+    if (powers && begin < m_numResonators) {
+        m_kernels->powers(std::min(count, m_numResonators - begin), m_stride, m_rr.data() + begin, powers + begin);
+    }
+}
+
+template <typename Real>
+void ResonatorBankVecT<Real>::updateConcurrent(const Real *frameData, size_t frameLength, size_t sampleStride, Real *powers) {
+    const size_t numSamples = (frameLength + sampleStride - 1) / sampleStride;
+    if (!m_threadPool) {
+        for (size_t shard = 0; shard < m_numShards; ++shard) {
+            updateShard(shard, frameData, frameLength, sampleStride, powers);
+        }
+    } else {
+        m_threadPool->run(m_numShards, [&](size_t shard) {
+            updateShard(shard, frameData, frameLength, sampleStride, powers);
+        });
+    }
+    advancePhaseCounter(numSamples, *std::max_element(m_shardDrifts.begin(), m_shardDrifts.end()));
+    publishSnapshot();
+}
+
+template <typename Real>
+void ResonatorBankVecT<Real>::setSnapshotsEnabled(bool enabled) {
+    if (!enabled) {
+        m_snapshot.reset();
+        return;
+    }
+    if (!m_snapshot) {
+        m_snapshot = std::make_unique<Snapshot>(3, m_numResonators);
+        m_snapshotValues.resize(3 * m_numResonators);
+        m_publishedValues.resize(std::is_same<Real, float>::value ? 0 : 3 * m_numResonators);
+    }
+}
+
+/// Publish the powers, amplitudes and phases of RR at the end of a frame, if snapshots are enabled
+template <typename Real>
+void ResonatorBankVecT<Real>::publishSnapshot() noexcept {
+    if (!m_snapshot) {
+        return;
+    }
+    const size_t n = m_numResonators;
+    Real *values = m_snapshotValues.data();
+    m_kernels->powers(n, m_stride, m_rr.data(), values);
+    m_kernels->amplitudes(n, m_stride, m_rr.data(), values + n);
+    m_kernels->phases(n, m_stride, m_rr.data(), values + 2 * n);
+    if constexpr (std::is_same<Real, float>::value) {
+        m_snapshot->publish(values, ++m_snapshotVersion);
+    } else {
+        std::copy(values, values + 3 * n, m_publishedValues.begin());
+        m_snapshot->publish(m_publishedValues.data(), ++m_snapshotVersion);
+    }
+}
+
+template <typename Real>
+uint64_t ResonatorBankVecT<Real>::getSnapshot(float *powers, float *amplitudes, float *phases, size_t size) const {
+    if (size < m_numResonators) {
+        OSCILLATORS_THROW(std::out_of_range("Buffer passed to getSnapshot() is not large enough"));
+    }
+    if (!m_snapshot) {
+        return 0;
+    }
+    float *const fields[3] = { powers, amplitudes, phases };
+    return m_snapshot->read(fields);
+}
+
+/// Precompute the batch mode weights for blocks of blockSize samples.
+/// For resonator k, with a = 1-alpha, b = 1-beta and initial state r0, rr0, z0, after B samples s_n:
+///   r_B  = a^B r0 + z0 * sum_n C_n s_n,                  C_n = alpha a^(B-1-n) W^n
+///   rr_B = b^B rr0 + K r0 + z0 * sum_n D_n s_n,          D_n = alpha beta W^n g_(B-1-n),  K = beta a g_(B-1)
+///   z_B  = z0 W^B
+/// where g_L = sum_{j=0..L} b^(L-j) a^j.
+template <typename Real>
+void ResonatorBankVecT<Real>::prepareBatch(size_t blockSize) {
+    if (blockSize == 0) {
+        OSCILLATORS_THROW(std::invalid_argument("Bad block size passed to prepareBatch()"));
+    }
+    const size_t n = m_numResonators;
+    m_batchBlockSize = blockSize;
+    m_batchWeights.assign(blockSize * 4 * n, Real(0));
+    m_batchDecays.resize(3 * n);
+    m_batchRotations.resize(2 * n);
+    for (size_t k=0; k<n; ++k) {
+        prepareBatchResonator(k);
+    }
+}
+
+/// Batch mode weights of resonator k (see prepareBatch()), from the coefficients read by the update kernels
+/// (the angle of the stored W rather than the exact angular frequency), so that batch and frame updates agree
+template <typename Real>
+void ResonatorBankVecT<Real>::prepareBatchResonator(size_t k) {
+    const size_t n = m_numResonators;
+    const size_t width = 4 * n;
+    const size_t blockSize = m_batchBlockSize;
+    Real kernelAlpha, kernelBeta;
+    double omega;
+    m_tables->kernelCoefficients(k, kernelAlpha, kernelBeta, omega);
+    const double alpha = kernelAlpha;
+    const double beta = kernelBeta;
+    const double a = 1.0 - alpha;
+    const double b = 1.0 - beta;
+
+    // g_L = b g_(L-1) + a^L
+    std::vector<double> g(blockSize);
+    double aPower = 1.0;
+    g[0] = 1.0;
+    for (size_t l=1; l<blockSize; ++l) {
+        aPower *= a;
+        g[l] = b * g[l-1] + aPower;
+    }
+
+    // a^(B-1-n), accumulated from the end of the block
+    double aPowerFromEnd = 1.0;
+    for (size_t s=blockSize; s-- > 0; ) {
+        const double c = std::cos(omega * static_cast<double>(s));
+        const double si = std::sin(omega * static_cast<double>(s));
+        Real *row = m_batchWeights.data() + s * width;
+        row[k] = static_cast<Real>(alpha * aPowerFromEnd * c);
+        row[n + k] = static_cast<Real>(alpha * aPowerFromEnd * si);
+        const double d = alpha * beta * g[blockSize - 1 - s];
+        row[2 * n + k] = static_cast<Real>(d * c);
+        row[3 * n + k] = static_cast<Real>(d * si);
+        aPowerFromEnd *= a;
+    }
+
+    m_batchDecays[k] = static_cast<Real>(aPowerFromEnd);
+    m_batchDecays[n + k] = static_cast<Real>(std::pow(b, static_cast<double>(blockSize)));
+    m_batchDecays[2 * n + k] = static_cast<Real>(beta * a * g[blockSize - 1]);
+    m_batchRotations[k] = static_cast<Real>(std::cos(omega * static_cast<double>(blockSize)));
+    m_batchRotations[n + k] = static_cast<Real>(std::sin(omega * static_cast<double>(blockSize)));
+}
+
+template <typename Real>
+void ResonatorBankVecT<Real>::updateBatch(const Real *data, size_t length, size_t sampleStride, Real *powers) {
+    if (m_batchBlockSize == 0) {
+        OSCILLATORS_THROW(std::logic_error("prepareBatch() must be called before updateBatch()"));
+    }
+    // blocks are multiplied by the weights in chunks, to bound the size of the products buffer
+    constexpr size_t maxBlocksPerChunk = 64;
+    const size_t n = m_numResonators;
+    const size_t width = 4 * n;
+    const size_t blockSize = m_batchBlockSize;
+    const size_t numSamples = (length + sampleStride - 1) / sampleStride;
+    const size_t numBlocks = numSamples / blockSize;
+    m_batchProducts.resize(std::min(numBlocks, maxBlocksPerChunk) * width);
+    if (sampleStride != 1) {
+        m_batchSamples.resize(std::min(numBlocks, maxBlocksPerChunk) * blockSize);
+    }
+
+    Real *rRe = m_r.data();
+    Real *rIm = m_r.data() + m_stride;
+    Real *rrRe = m_rr.data();
+    Real *rrIm = m_rr.data() + m_stride;
+    Real *zRe = m_z.data();
+    Real *zIm = m_z.data() + m_stride;
+    const Real *omAlphasB = m_batchDecays.data();
+    const Real *omBetasB = m_batchDecays.data() + n;
+    const Real *rToRR = m_batchDecays.data() + 2 * n;
+    const Real *wbRe = m_batchRotations.data();
+    const Real *wbIm = m_batchRotations.data() + n;
+
+    for (size_t firstBlock = 0; firstBlock < numBlocks; firstBlock += maxBlocksPerChunk) {
+        const size_t chunkBlocks = std::min(maxBlocksPerChunk, numBlocks - firstBlock);
+        const Real *samples = data + firstBlock * blockSize * sampleStride;
+        if (sampleStride != 1) {
+            for (size_t i=0; i<chunkBlocks * blockSize; ++i) {
+                m_batchSamples[i] = samples[i * sampleStride];
+            }
+            samples = m_batchSamples.data();
+        }
+        // (chunkBlocks x B) * (B x 4N)
+        m_kernels->matrixMultiply(samples, blockSize, m_batchWeights.data(), width, m_batchProducts.data(), width,
+                                  chunkBlocks, width, blockSize);
+
+        // propagate the state from block to block
+        for (size_t f=0; f<chunkBlocks; ++f) {
+            const Real *uRe = m_batchProducts.data() + f * width;
+            const Real *uIm = uRe + n;
+            const Real *vRe = uRe + 2 * n;
+            const Real *vIm = uRe + 3 * n;
+            OSCILLATORS_VECTORIZE
+            for (size_t k=0; k<n; ++k) {
+                const Real rr0 = rrRe[k], ri0 = rrIm[k];
+                rrRe[k] = omBetasB[k] * rr0 + rToRR[k] * rRe[k] + zRe[k] * vRe[k] - zIm[k] * vIm[k];
+                rrIm[k] = omBetasB[k] * ri0 + rToRR[k] * rIm[k] + zRe[k] * vIm[k] + zIm[k] * vRe[k];
+                rRe[k] = omAlphasB[k] * rRe[k] + zRe[k] * uRe[k] - zIm[k] * uIm[k];
+                rIm[k] = omAlphasB[k] * rIm[k] + zRe[k] * uIm[k] + zIm[k] * uRe[k];
+                const Real zr = zRe[k] * wbRe[k] - zIm[k] * wbIm[k];
+                const Real zi = zRe[k] * wbIm[k] + zIm[k] * wbRe[k];
+                zRe[k] = zr;
+                zIm[k] = zi;
+            }
+            normalizePhasors(blockSize);
+            if (powers) {
+                m_kernels->powers(n, m_stride, m_rr.data(), powers + (firstBlock + f) * n);
+            }
+        }
+    }
+
+    // trailing samples (published by the frame update)
+    const size_t processed = numBlocks * blockSize * sampleStride;
+    if (processed < length) {
+        update(data + processed, length - processed, sampleStride);
+    } else {
+        publishSnapshot();
+    }
+}
+
+/// Smallest L such that the contributions of the initial state to R and RR after L samples,
+/// a^L |r0| and b^L |rr0| + beta sum_{j=1..L} a^j b^(L-j) |r0|, are below tolerance (for |r0|, |rr0| <= 1)
+template <typename Real>
+size_t ResonatorBankVecT<Real>::warmUpLength(Real tolerance) const {
+    if (!(tolerance > Real(0)) || tolerance >= Real(1)) {
+        OSCILLATORS_THROW(std::invalid_argument("Bad tolerance passed to warmUpLength()"));
+    }
+    if (m_numResonators == 0) {
+        return 0;
+    }
+    // the slowest decays, for the smallest alpha and beta
+    const double alpha = *std::min_element(m_tables->alphas.begin(), m_tables->alphas.begin() + m_numResonators);
+    const double beta = *std::min_element(m_tables->betas.begin(), m_tables->betas.begin() + m_numResonators);
+    const double a = 1.0 - alpha;
+    const double b = 1.0 - beta;
+    auto remaining = [&](size_t length) {
+        const double l = static_cast<double>(length);
+        return std::max(std::pow(a, l), std::pow(b, l) + beta * decaySum(a, b, l));
+    };
+    // the remaining contribution decreases once past its peak: double, then bisect
+    size_t high = 1;
+    while (remaining(high) > tolerance) {
+        if (high > (size_t(1) << 40)) {
+            OSCILLATORS_THROW(std::invalid_argument("Bad alphas or betas for warmUpLength()"));
+        }
+        high *= 2;
+    }
+    size_t low = high / 2;
+    while (low + 1 < high) {
+        const size_t middle = (low + high) / 2;
+        if (remaining(middle) > tolerance) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+    return high;
+}
+
+template <typename Real>
+size_t ResonatorBankVecT<Real>::updateParallel(const Real *data, size_t length, size_t sampleStride, size_t outputInterval,
+                                        Real *powers, Real *amplitudes, Real tolerance) {
+    if (outputInterval == 0) {
+        OSCILLATORS_THROW(std::invalid_argument("Bad outputInterval passed to updateParallel()"));
+    }
+    const size_t warmUp = warmUpLength(tolerance);
+    if (m_samplesSinceOutput >= outputInterval) {
+        m_samplesSinceOutput = 0;
+    }
+    const size_t samplesSinceOutput = m_samplesSinceOutput;
+    const size_t numSamples = (length + sampleStride - 1) / sampleStride;
+    const size_t numRows = (samplesSinceOutput + numSamples) / outputInterval;
+
+    // segments of whole output intervals, long enough for the warm-up to be amortized
+    // (segment boundaries at the outputs, i.e. at samples i where samplesSinceOutput + i is a multiple of outputInterval)
+    const size_t firstBoundary = (outputInterval - samplesSinceOutput % outputInterval) % outputInterval;
+    const size_t numIntervals = numSamples > firstBoundary ? (numSamples - firstBoundary) / outputInterval : 0;
+    const size_t maxSegments = std::max(size_t(1), numSamples / std::max(size_t(1), 2 * warmUp));
+    const size_t numSegments = std::max(size_t(1), std::min({numThreads(), maxSegments, numIntervals}));
+    if (numSegments == 1) {
+        return update(data, length, sampleStride, outputInterval, powers, amplitudes);
+    }
+    std::vector<size_t> boundaries(numSegments + 1);
+    for (size_t segment = 1; segment < numSegments; ++segment) {
+        boundaries[segment] = firstBoundary + segment * numIntervals / numSegments * outputInterval;
+    }
+    boundaries[0] = 0;
+    boundaries[numSegments] = numSamples;
+
+    // segment banks, warmed up from a zero state (or from this bank's state if the warm-up reaches the first sample),
+    // with phasors rotated to their phase at the start of the warm-up.
+    // The first segment also runs on its own bank, so that this bank's state, resync counters and snapshot
+    // are only updated once all the segments are done.
+    std::vector<std::unique_ptr<ResonatorBankVecT>> banks(numSegments);
+    auto runSegment = [&](size_t segment) {
+        const size_t begin = boundaries[segment];
+        const size_t end = boundaries[segment + 1];
+        const size_t firstRow = (samplesSinceOutput + begin) / outputInterval;
+        const size_t rowOffset = firstRow * m_numResonators;
+        banks[segment].reset(new ResonatorBankVecT(m_tables));
+        ResonatorBankVecT &bank = *banks[segment];
+        bank.setKernelVariant(kernelVariant());
+        bank.m_silenceThreshold = m_silenceThreshold;
+        const size_t warmUpBegin = begin > warmUp ? begin - warmUp : 0;
+        if (m_phasorResync) {
+            bank.m_phasorResync = true;
+            bank.m_fixedResyncInterval = m_fixedResyncInterval;
+            bank.m_resyncInterval = m_resyncInterval;
+            bank.m_resyncPhases = m_resyncPhases;
+            bank.m_resyncPhasors.resize(2 * m_stride);
+            bank.m_samplesSinceResync = m_samplesSinceResync;
+        }
+        if (warmUpBegin == 0) {
+            bank.m_r = m_r;
+            bank.m_rr = m_rr;
+            bank.m_z = m_z;
+        } else {
+            // exact phases when resyncing (the new anchor of the bank's resync), from the current phasors otherwise
+            const double elapsed = static_cast<double>(m_samplesSinceResync + warmUpBegin);
+            for (size_t k=0; k<m_paddedNumResonators; ++k) {
+                double phase;
+                if (m_phasorResync) {
+                    phase = m_resyncPhases[k] + m_tables->omegas[k] * elapsed;
+                    phase -= twoPiValue<double> * std::floor(phase / twoPiValue<double> + 0.5);
+                    bank.m_resyncPhases[k] = phase;
+                } else {
+                    phase = std::atan2(static_cast<double>(m_z[m_stride + k]), static_cast<double>(m_z[k]))
+                        + m_tables->omegas[k] * static_cast<double>(warmUpBegin);
+                }
+                bank.m_z[k] = static_cast<Real>(std::cos(phase));
+                bank.m_z[m_stride + k] = static_cast<Real>(std::sin(phase));
+            }
+            bank.m_samplesSinceResync = 0;
+        }
+        if (begin > warmUpBegin) {
+            bank.update(data + warmUpBegin * sampleStride, (begin - warmUpBegin) * sampleStride, sampleStride);
+        }
+        // the other segments start at an output
+        if (segment == 0) {
+            bank.m_samplesSinceOutput = samplesSinceOutput;
+        }
+        bank.update(data + begin * sampleStride, std::min(length, end * sampleStride) - begin * sampleStride, sampleStride,
+                    outputInterval, powers ? powers + rowOffset : nullptr, amplitudes ? amplitudes + rowOffset : nullptr);
+    };
+    if (m_threadPool) {
+        m_threadPool->run(numSegments, runSegment);
+    } else {
+        for (size_t segment = 0; segment < numSegments; ++segment) {
+            runSegment(segment);
+        }
+    }
+
+    // continue from the state at the end of the last segment
+    ResonatorBankVecT &last = *banks[numSegments - 1];
+    m_r = last.m_r;
+    m_rr = last.m_rr;
+    m_z = last.m_z;
+    m_samplesSinceOutput = last.m_samplesSinceOutput;
+    if (m_phasorResync) {
+        m_resyncInterval = last.m_resyncInterval;
+        m_samplesSinceResync = last.m_samplesSinceResync;
+        m_resyncPhases = last.m_resyncPhases;
+    }
+    publishSnapshot();
+    return numRows;
+}
+
+/// Checkpoint layout, after the header: in double precision the exact sample rate (see ResonatorT::saveSampleRate()),
+/// scalars (see checkpointScalarsSize), frequencies | alphas | betas, R | RR | Z (real | imaginary parts),
+/// tracking phases (N values each, in Real), and in phasor resync mode the phases at the last resync (N doubles)
+template <typename Real>
+size_t ResonatorBankVecT<Real>::checkpointSize(size_t numResonators, bool phasorResync) {
+    return sizeof(CheckpointHeader) + ResonatorT<Real>::checkpointSampleRateSize + checkpointScalarsSize<Real>
+        + 10 * numResonators * sizeof(Real)
+        + (phasorResync ? numResonators * sizeof(double) : 0);
+}
+
+template <typename Real>
+size_t ResonatorBankVecT<Real>::checkpointSize() const {
+    return checkpointSize(m_numResonators, m_phasorResync);
+}
+
+template <typename Real>
+size_t ResonatorBankVecT<Real>::saveCheckpoint(void *data, size_t size) const {
+    if (size < checkpointSize()) {
+        OSCILLATORS_THROW(std::out_of_range("Buffer passed to saveCheckpoint() is not large enough"));
+    }
+    const size_t n = m_numResonators;
+    const CheckpointHeader header = { checkpointMagic, checkpointVersion, static_cast<uint16_t>(CheckpointType::ResonatorBankVec),
+        checkpointSize(), n, static_cast<float>(m_sampleRate),
+        static_cast<uint8_t>(sizeof(Real)), static_cast<uint8_t>(sizeof(Real)), 0 };
+    CheckpointWriter writer(data, header);
+    ResonatorT<Real>::saveSampleRate(writer, m_sampleRate);
+    writer.write(m_silenceThreshold);
+    writer.write(static_cast<uint32_t>(m_phasorResync));
+    writer.write(static_cast<uint64_t>(m_samplesSinceOutput));
+    writer.write(static_cast<uint64_t>(m_fixedResyncInterval));
+    writer.write(static_cast<uint64_t>(m_resyncInterval));
+    writer.write(static_cast<uint64_t>(m_samplesSinceResync));
+    writer.write(m_tables->frequencies.data(), n);
+    writer.write(m_tables->alphas.data(), n);
+    writer.write(m_tables->betas.data(), n);
+    for (const AlignedVector<Real> *values : { &m_r, &m_rr, &m_z }) {
+        writer.write(values->data(), n);
+        writer.write(values->data() + m_stride, n);
+    }
+    writer.write(m_phases.data(), n);
+    if (m_phasorResync) {
+        writer.write(m_resyncPhases.data(), n);
+    }
+    return writer.offset();
+}
+
+template <typename Real>
+void ResonatorBankVecT<Real>::restoreCheckpoint(const void *data, size_t size) {
+    const CheckpointHeader header = readCheckpointHeader(data, size, CheckpointType::ResonatorBankVec);
+    if (!checkpointPrecisionMatches<Real>(header)) {
+        OSCILLATORS_THROW(std::invalid_argument("Wrong precision of the checkpoint passed to restoreCheckpoint()"));
+    }
+    const size_t n = m_numResonators;
+    if (header.numResonators != n || header.size < checkpointSize(n, false)) {
+        OSCILLATORS_THROW(std::invalid_argument("Bad checkpoint passed to restoreCheckpoint()"));
+    }
+    CheckpointReader reader(data);
+    if (ResonatorT<Real>::restoreSampleRate(reader, header) != m_sampleRate) {
+        OSCILLATORS_THROW(std::invalid_argument("Bad checkpoint passed to restoreCheckpoint()"));
+    }
+    const Real silenceThreshold = reader.read<Real>();
+    const bool phasorResync = reader.read<uint32_t>() != 0;
+    if (header.size != checkpointSize(n, phasorResync)) {
+        OSCILLATORS_THROW(std::invalid_argument("Bad checkpoint passed to restoreCheckpoint()"));
+    }
+    m_silenceThreshold = silenceThreshold;
+    m_phasorResync = phasorResync;
+    m_samplesSinceOutput = reader.read<uint64_t>();
+    m_fixedResyncInterval = reader.read<uint64_t>();
+    m_resyncInterval = reader.read<uint64_t>();
+    m_samplesSinceResync = reader.read<uint64_t>();
+
+    // coefficients recomputed only for the resonators configured differently
+    const uint8_t *frequencies = reader.skip(n * sizeof(Real));
+    const uint8_t *alphas = reader.skip(n * sizeof(Real));
+    const uint8_t *betas = reader.skip(n * sizeof(Real));
+    for (size_t k=0; k<n; ++k) {
+        Real frequency, alpha, beta;
+        memcpy(&frequency, frequencies + k * sizeof(Real), sizeof(Real));
+        memcpy(&alpha, alphas + k * sizeof(Real), sizeof(Real));
+        memcpy(&beta, betas + k * sizeof(Real), sizeof(Real));
+        if (frequency != m_tables->frequencies[k] || alpha != m_tables->alphas[k] || beta != m_tables->betas[k]) {
+            mutableTables().setResonator(k, frequency, alpha, beta);
+            if (m_batchBlockSize) {
+                prepareBatchResonator(k);
+            }
+        }
+    }
+
+    for (AlignedVector<Real> *values : { &m_r, &m_rr, &m_z }) {
+        reader.read(values->data(), n);
+        reader.read(values->data() + m_stride, n);
+    }
+    reader.read(m_phases.data(), n);
+    if (m_phasorResync) {
+        // padding resonators stay at phase 0
+        m_resyncPhases.assign(m_stride, 0.0);
+        m_resyncPhasors.resize(2 * m_stride);
+        reader.read(m_resyncPhases.data(), n);
+    }
+    publishSnapshot();
+}
+
+template <typename Real>
+std::shared_ptr<ResonatorBankVecTablesT<Real>> ResonatorBankVecT<Real>::checkpointTables(const void *checkpoint, size_t size) {
+    const CheckpointHeader header = readCheckpointHeader(checkpoint, size, CheckpointType::ResonatorBankVec);
+    if (!checkpointPrecisionMatches<Real>(header)) {
+        OSCILLATORS_THROW(std::invalid_argument("Wrong precision of the checkpoint passed to ResonatorBankVec()"));
+    }
+    const size_t n = header.numResonators;
+    if (header.size < checkpointSize(n, false)) {
+        OSCILLATORS_THROW(std::invalid_argument("Bad checkpoint passed to ResonatorBankVec()"));
+    }
+    CheckpointReader reader(checkpoint);
+    const Real sampleRate = ResonatorT<Real>::restoreSampleRate(reader, header);
+    reader.skip(checkpointScalarsSize<Real>);
+    std::vector<Real> frequencies(n), alphas(n), betas(n);
+    reader.read(frequencies.data(), n);
+    reader.read(alphas.data(), n);
+    reader.read(betas.data(), n);
+    return std::make_shared<ResonatorBankVecTablesT<Real>>(n, frequencies.data(), alphas.data(), betas.data(), sampleRate);
+}
+
+template <typename Real>
+ResonatorBankVecT<Real>::ResonatorBankVecT(const void *checkpoint, size_t size)
+: ResonatorBankVecT(checkpointTables(checkpoint, size), nullptr) {
+    m_ownsTables = true;
+    restoreCheckpoint(checkpoint, size);
+}
+
+template struct oscillators_cpp::ResonatorBankVecTablesT<float>;
+template struct oscillators_cpp::ResonatorBankVecTablesT<double>;
+template class oscillators_cpp::ResonatorBankVecT<float>;
+template class oscillators_cpp::ResonatorBankVecT<double>;
@@ -25,67 +25,370 @@ SOFTWARE.
 #ifndef ResonatorBankVec_hpp
 #define ResonatorBankVec_hpp
 
+#include "Arena.hpp"
+#include "Checkpoint.hpp"
+#include "PCM.hpp"
+#include "ResonatorBankVecKernels.hpp"
+#include "Snapshot.hpp"
+#include "ThreadPool.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <vector>
 
 namespace oscillators_cpp {
 
-class ResonatorBankVec {
+/// Coefficient tables of a ResonatorBankVec, which banks with the same configuration can share read-only
+/// (e.g. one bank per stream, see MultiStreamEngine).
+/// Alphas, betas and phasor multipliers are non-interlaced (2 * stride values, real | imaginary parts).
+template <typename Real>
+struct ResonatorBankVecTablesT {
+    /// Silence: number of precomputed jumps (over 2^level silent samples, for level in [0, silenceLevels))
+    static constexpr size_t silenceLevels = 10;
+
+    Real sampleRate;
+    size_t numResonators;
+    /// Number of resonators rounded up to a multiple of the largest kernel block: the kernels updating the state
+    /// process this many resonators, i.e. always whole blocks. The padding resonators have neutral coefficients
+    /// (alpha = beta = 0, w = 1).
+    size_t paddedNumResonators;
+    /// Capacity, offset of the imaginary parts (paddedNumResonators, or more after insertions)
+    size_t stride;
+    AlignedVector<Real> frequencies;
+    AlignedVector<Real> alphas;
+    AlignedVector<Real> omAlphas;
+    AlignedVector<Real> betas;
+    AlignedVector<Real> omBetas;
+    /// Phasor multipliers
+    AlignedVector<Real> w;
+    /// Exact angular frequencies (radians per sample), stride values
+    AlignedVector<double> omegas;
+    /// Silence: for each level, (1-alpha)^L | (1-beta)^L | contribution of R to RR | W^L real | W^L imag,
+    /// stride values each (L = 2^level)
+    AlignedVector<Real> silenceJumps;
+    /// Storage precision of the coefficients read by the update kernels
+    CoefficientPrecision precision;
+    /// With Float16 or BFloat16 precision: alphas | betas | W real | W imag in 16 bits, stride values each (empty otherwise)
+    AlignedVector<uint16_t> reducedCoefficients;
+
+    /// The buffers are allocated from arena if not null (which must then outlive the tables), from the heap otherwise
+    ResonatorBankVecTablesT(size_t numResonators, const Real* frequencies, const Real* alphas, const Real* betas, Real sampleRate,
+                            Arena *arena = nullptr);
+
+    /// Arena space taken by the tables (object included)
+    static size_t arenaSize(size_t numResonators);
+
+    /// Set the coefficients of resonator k (in [0, stride)), silence jumps included.
+    /// Frequency, alpha and beta 0 give the neutral coefficients of a padding resonator.
+    void setResonator(size_t k, Real frequency, Real alpha, Real beta);
+    /// Insert a resonator at index, growing the capacity geometrically when full
+    void insertResonator(size_t index, Real frequency, Real alpha, Real beta);
+    void removeResonator(size_t index);
+
+    /// Set the precision of the coefficients read by the update kernels, (re)computing the 16-bit coefficients
+    void setPrecision(CoefficientPrecision precision);
+    /// 16-bit coefficients from resonator begin on, for the kernels
+    ReducedCoefficients reduced(size_t begin) const;
+    /// Coefficients of resonator k as read by the update kernels (Real, or widened from 16 bits):
+    /// alpha, beta, and the angle of the phasor multiplier W in radians per sample
+    void kernelCoefficients(size_t k, Real &alpha, Real &beta, double &angle) const;
+
+private:
+    void setSilenceJumps(size_t k);
+    void setReducedCoefficients(size_t k);
+};
+
+extern template struct ResonatorBankVecTablesT<float>;
+extern template struct ResonatorBankVecTablesT<double>;
+
+using ResonatorBankVecTables = ResonatorBankVecTablesT<float>;
+
+/// Accuracy of a ResonatorBankVec with reduced precision coefficients, relative to the same bank with full precision
+/// coefficients (see ResonatorBankVec::precisionReport())
+struct CoefficientPrecisionReport {
+    /// Largest difference of the frequencies of the phasors, in Hz, and relative to the frequency
+    float maxFrequencyError;
+    float maxRelativeFrequencyError;
+    /// Largest relative differences of alpha and beta (i.e. of the time constants)
+    float maxAlphaError;
+    float maxBetaError;
+    /// Largest and mean differences of the powers after each hop, relative to the largest power of the hop
+    float maxPowerError;
+    float meanPowerError;
+};
+
+/// Vectorized bank of resonators (non-interlaced state arrays, updated by the kernels of ResonatorBankVecKernels.hpp).
+/// Templated on the precision, explicitly instantiated in ResonatorBankVec.cpp: samples, coefficients, state and results
+/// are in Real, float or double (8 or 16 resonators per kernel block in double instead of 16 or 32 in float, i.e. half
+/// the throughput), with the exact phases of the phasor resync in double in both (snapshots are published in float).
+template <typename Real>
+class ResonatorBankVecT {
 private:
-    float m_sampleRate;
+    Real m_sampleRate;
     size_t m_numResonators;
-    
-    std::vector<float> m_frequencies;
-    std::vector<float> m_alphas;
-    std::vector<float> m_omAlphas;
-    std::vector<float> m_betas;
-    std::vector<float> m_omBetas;
-    
-    size_t m_twoNumResonators;
+
+    /// Coefficients, possibly shared with other banks
+    std::shared_ptr<const ResonatorBankVecTablesT<Real>> m_tables;
+    /// Whether the tables were created by this bank (or copied), and can be modified when not shared
+    bool m_ownsTables;
+
+    /// Number of resonators processed by the kernels updating the state, and offset of the imaginary parts
+    /// in the non-interlaced arrays (see ResonatorBankVecTablesT)
+    size_t m_paddedNumResonators;
+    size_t m_stride;
+
+    /// Block holding the state buffers, allocated once (empty if the bank was constructed in a caller-supplied arena)
+    Arena m_stateArena;
 
     /// Accumulated resonance values, non-interlaced real (cos) | imaginary (sin) parts
-    std::vector<float> m_r;
+    AlignedVector<Real> m_r;
     /// Smoothed accumulated resonance values, non-interlaced real (cos) | imaginary (sin) parts
-    std::vector<float> m_rr;
+    AlignedVector<Real> m_rr;
     
     /// Phasors
-    std::vector<float> m_z;
-    /// Phasor multipliers
-    std::vector<float> m_w;
-    
-    /// hold sample value * alphas
-    std::vector<float> m_alphasSample;
+    AlignedVector<Real> m_z;
+
+    /// Tracking: phase of RR at the end of the last tracked frame
+    AlignedVector<Real> m_phases;
+
+    /// Kernel functions for the instruction set variant in use
+    const ResonatorBankVecKernelsT<Real> *m_kernels;
 
-    /// Squared magnitudes buffer (ntermediate calculations)
-    std::vector<float> m_sm;
-    /// Reverse square root buffer (intermediate calculations)
-    std::vector<float> m_rsqrt;
+    /// Full time resolution output: number of samples processed since the last output
+    size_t m_samplesSinceOutput;
 
+    /// Concurrent update: worker threads (null until setNumThreads() is called with more than 1 thread)
+    std::unique_ptr<ThreadPool> m_threadPool;
+    /// Concurrent update: number of contiguous shards of resonators (a multiple of the number of threads)
+    size_t m_numShards;
+
+    size_t shardBegin(size_t shard) const;
+    void updateShard(size_t shard, const Real *frameData, size_t frameLength, size_t sampleStride, Real *powers);
+
+    /// Silence: samples with an absolute value at or below this threshold are treated as zero
+    Real m_silenceThreshold;
+
+    void skipSilence(size_t begin, size_t count, size_t numSamples) noexcept;
+    void updateRange(size_t begin, size_t count, const Real *frameData, size_t frameLength, size_t sampleStride) noexcept;
+    /// Update kernel (for the precision of the coefficients) on resonators [begin, begin+count)
+    void runUpdateKernel(size_t begin, size_t count, const Real *frameData, size_t frameLength, size_t sampleStride) noexcept;
+
+    /// Phasor resync: enabled (phasors reset exactly, instead of stabilized after every frame)
+    bool m_phasorResync;
+    /// Phasor resync: fixed interval in samples (0 if adaptive)
+    size_t m_fixedResyncInterval;
+    /// Phasor resync: current interval in samples
+    size_t m_resyncInterval;
+    /// Phasor resync: number of samples processed since the last resync
+    size_t m_samplesSinceResync;
+    /// Phasor resync: phases of the phasors at the last resync, in [-PI, PI)
+    std::vector<double> m_resyncPhases;
+    /// Phasor resync: exact phasors (intermediate calculations), non-interlaced real | imaginary parts
+    std::vector<Real> m_resyncPhasors;
+    /// Phasor resync: drift measured by each shard at the last resync
+    AlignedVector<Real> m_shardDrifts;
+
+    void normalizePhasors(size_t numSamples) noexcept;
+    Real normalizePhasorRange(size_t begin, size_t count, size_t numSamples) noexcept;
+    void advancePhaseCounter(size_t numSamples, Real drift) noexcept;
+
+    /// Snapshots: published powers | amplitudes | phases (null if disabled)
+    std::unique_ptr<Snapshot> m_snapshot;
+    /// Snapshots: values to publish (intermediate calculations)
+    std::vector<Real> m_snapshotValues;
+    /// Snapshots: values to publish converted to float, when Real is double (intermediate calculations)
+    std::vector<float> m_publishedValues;
+    /// Snapshots: number of frames published
+    uint64_t m_snapshotVersion;
+
+    void publishSnapshot() noexcept;
+
+    /// Batch mode: number of samples per block (0 if not prepared)
+    size_t m_batchBlockSize;
+    /// Batch mode: contribution of each sample of a block to R and RR, blockSize x 4N (row-major),
+    /// each row C real | C imag | D real | D imag
+    std::vector<Real> m_batchWeights;
+    /// Batch mode: (1-alpha)^B | (1-beta)^B | contribution of R to RR over a block, N each
+    std::vector<Real> m_batchDecays;
+    /// Batch mode: W^B, non-interlaced real | imaginary parts
+    std::vector<Real> m_batchRotations;
+    /// Batch mode: products of blocks of samples by the weights (intermediate calculations)
+    std::vector<Real> m_batchProducts;
+    /// Batch mode: gathered samples, when the sample stride is not 1 (intermediate calculations)
+    std::vector<Real> m_batchSamples;
+
+    ResonatorBankVecT(std::shared_ptr<const ResonatorBankVecTablesT<Real>> tables, Arena *arena);
+    /// Space taken by the state buffers
+    static size_t stateSize(size_t numResonators);
+
+    /// Tables that can be modified: copied first if they are (or may be) shared with other banks
+    ResonatorBankVecTablesT<Real>& mutableTables();
+    void setNumShards();
+    void resonatorsChanged(size_t index);
+    void prepareBatchResonator(size_t k);
+
+    static size_t checkpointSize(size_t numResonators, bool phasorResync);
+    static std::shared_ptr<ResonatorBankVecTablesT<Real>> checkpointTables(const void *checkpoint, size_t size);
     
 public:
-    ResonatorBankVec & operator=(const ResonatorBankVec&) = delete;
-    ResonatorBankVec(const ResonatorBankVec&) = delete;
+    ResonatorBankVecT & operator=(const ResonatorBankVecT&) = delete;
+    ResonatorBankVecT(const ResonatorBankVecT&) = delete;
 
-    ResonatorBankVec(size_t numResonators, const std::vector<float> &frequencies, const std::vector<float> &alphas, const std::vector<float> &betas, float sampleRate);
-    ResonatorBankVec(size_t numResonators, const float* frequencies, const float* alphas, const float* betas, float sampleRate);
+    ResonatorBankVecT(size_t numResonators, const std::vector<Real> &frequencies, const std::vector<Real> &alphas, const std::vector<Real> &betas, Real sampleRate);
+    ResonatorBankVecT(size_t numResonators, const Real* frequencies, const Real* alphas, const Real* betas, Real sampleRate);
+    /// Bank sharing its coefficient tables with other banks
+    ResonatorBankVecT(std::shared_ptr<const ResonatorBankVecTablesT<Real>> tables);
+    /// Bank with its tables and state in a caller-supplied arena (see Arena) of at least arenaSize(numResonators) bytes,
+    /// e.g. preallocated memory, so that the bank can be set up and torn down on a real-time thread.
+    /// The arena must outlive the bank, and any bank sharing its tables.
+    /// (The other constructors allocate the state in a single aligned block.)
+    ResonatorBankVecT(size_t numResonators, const Real* frequencies, const Real* alphas, const Real* betas, Real sampleRate,
+                      Arena &arena);
+    static size_t arenaSize(size_t numResonators);
 
-    float sampleRate() { return m_sampleRate; }
+    Real sampleRate() { return m_sampleRate; }
     size_t numResonators() { return m_numResonators; }
-    float frequencyValue(size_t index);
-    float alphaValue(size_t index);
-    void setAllAlphas(float alpha);
-    float betaValue(size_t index);
+    const std::shared_ptr<const ResonatorBankVecTablesT<Real>>& tables() const { return m_tables; }
+    Real frequencyValue(size_t index);
+    Real alphaValue(size_t index);
+    void setAllAlphas(Real alpha);
+    Real betaValue(size_t index);
+    Real phaseValue(size_t index);
+
+    /// Retuning in place: only the coefficients of the resonators concerned are recomputed, and the state of all
+    /// the resonators is kept (a retuned resonator continues from its current resonance and phase).
+    /// Shared tables are copied first (copy on write). Not to be called concurrently with an update or getSnapshot().
+    void setFrequency(size_t index, Real frequency);
+    void setAlpha(size_t index, Real alpha);
+    void setBeta(size_t index, Real beta);
+    /// Insert a resonator (with a zero state) at index in [0, numResonators()], or remove the resonator at index.
+    /// The capacity grows geometrically, and the other resonators keep their state.
+    void insertResonator(size_t index, Real frequency, Real alpha, Real beta);
+    void removeResonator(size_t index);
+    size_t capacity() const { return m_stride; }
 
-    void getPowers(float *dest, size_t size);
-    void getAmplitudes(float *dest, size_t size);
+    /// Instruction set variant of the kernels in use (best supported by the CPU unless set explicitly)
+    KernelVariant kernelVariant() const { return m_kernels->variant; }
+    void setKernelVariant(KernelVariant variant);
 
-    void update(const float sample);
-    void update(const std::vector<float> &samples);
-    void update(const float *frameData, size_t frameLength, size_t sampleStride);
-    void update(const float *frameData, size_t frameLength, size_t sampleStride, float* powers, float* amplitudes);
+    /// Storage precision of the coefficients read by the frame updates (Float32 by default, i.e. the coefficients in Real).
+    /// With Float16 or BFloat16, the update kernels read alpha, beta and W in 16 bits (8 bytes per resonator instead of 24
+    /// in float, 48 in double), and widen them in registers: for very large banks, whose state and coefficients do not fit
+    /// in cache, this reduces the memory traffic of each frame (most for short frames). The Real coefficients are kept for
+    /// the other computations (silence jumps, phasor resync, batch mode, checkpoints). Shared tables are copied first,
+    /// and the 16-bit coefficients are allocated. See precisionReport() for the accuracy.
+    void setCoefficientPrecision(CoefficientPrecision precision);
+    CoefficientPrecision coefficientPrecision() const { return m_tables->precision; }
+    /// Accuracy of the bank with coefficients stored in precision, compared with Real coefficients: coefficient
+    /// errors, and power errors over the samples, processed from a zero state in frames of hop samples
+    /// (e.g. a representative excerpt of the signals to analyze). This bank is not modified.
+    CoefficientPrecisionReport precisionReport(CoefficientPrecision precision, const Real *samples, size_t numSamples, size_t hop) const;
 
-    void stabilize();
+    void getPowers(Real *dest, size_t size);
+    void getAmplitudes(Real *dest, size_t size);
+
+    /// The updates without output, updateAndTrack() and stabilize() never allocate nor throw
+    void update(const Real sample) noexcept;
+    void update(const std::vector<Real> &samples) noexcept;
+    void update(const Real *frameData, size_t frameLength, size_t sampleStride) noexcept;
+    /// Frame of integer PCM samples (frameLength and sampleStride in samples of the format), converted on the fly
+    /// (to float, then widened to Real) and multiplied by scale (e.g. pcmFullScale(format))
+    void update(const void *pcmData, PCMFormat format, size_t frameLength, size_t sampleStride, float scale) noexcept;
+    /// Full time resolution output: also write the powers and/or amplitudes (if not null) of all the resonators
+    /// after every sample, or every outputInterval samples (counted across calls), into rows of numResonators() values.
+    /// The buffers must hold (number of samples of the frame / outputInterval + 1) rows; returns the number of rows written.
+    size_t update(const Real *frameData, size_t frameLength, size_t sampleStride, Real* powers, Real* amplitudes);
+    size_t update(const Real *frameData, size_t frameLength, size_t sampleStride, size_t outputInterval, Real* powers, Real* amplitudes);
+
+    /// Process a frame of samples, then track frequencies (trackedFrequencies receives numResonators() values):
+    /// the frequency of resonators with an amplitude below trackFrequencyThreshold is left as is
+    void updateAndTrack(const Real *frameData, size_t frameLength, size_t sampleStride, Real *trackedFrequencies) noexcept;
+
+    void stabilize() noexcept;
+
+    /// Silence fast path: in update() and updateConcurrent(), runs of silent samples (absolute value at or below
+    /// the threshold, 0 by default, i.e. exact zeros only) are not processed sample by sample: the state jumps over
+    /// them in closed form. R and RR values that decay to (near) denormals are flushed to zero after each frame.
+    void setSilenceThreshold(Real threshold);
+    Real silenceThreshold() const { return m_silenceThreshold; }
+
+    /// Phasor resync mode (disabled by default): instead of stabilizing the phasors after every frame, keep a double
+    /// precision phase per resonator and reset the phasors exactly to exp(i*omega*n) at the end of the first frame
+    /// after every resyncInterval samples, which bounds the phase error of long running streams.
+    /// If resyncInterval is 0, the interval is adapted to the drift measured at each resync.
+    void setPhasorResync(bool enabled, size_t resyncInterval = 0);
+    bool phasorResync() const { return m_phasorResync; }
+    /// Current resync interval, in samples
+    size_t resyncInterval() const { return m_resyncInterval; }
+
+    /// Result snapshots (disabled by default), for readers on other threads: when enabled, the frame updates
+    /// (update(), updateConcurrent(), updateAndTrack(), updateBatch()) publish the powers, amplitudes and phases of RR
+    /// at the end of each frame through a lock-free Snapshot. getSnapshot() can then be called from any number
+    /// of threads while the bank is being updated, and never blocks the update.
+    /// setSnapshotsEnabled() itself must not be called concurrently with an update.
+    void setSnapshotsEnabled(bool enabled);
+    bool snapshotsEnabled() const { return m_snapshot != nullptr; }
+    /// Copy the latest published frame (numResonators() values in each non-null buffer).
+    /// Returns the number of frames published so far (0 if none, in which case the buffers are not written).
+    uint64_t getSnapshot(float *powers, float *amplitudes, float *phases, size_t size) const;
+
+    /// Concurrent update for large banks.
+    /// The resonators are split into contiguous shards of at most maxShardSize resonators (kept in cache over a frame),
+    /// at least one per thread, and the shards are processed in parallel on a persistent ThreadPool.
+    /// numThreads includes the calling thread, 0 for the number of hardware threads.
+    void setNumThreads(size_t numThreads, bool pinThreads = false);
+    size_t numThreads() const { return m_threadPool ? m_threadPool->numThreads() : 1; }
+    size_t numShards() const { return m_numShards; }
+    /// Process a frame of samples, each shard running the kernels on its slice of the bank, stabilization included.
+    /// If powers is not null, each shard also writes its powers directly to the corresponding slice of powers
+    /// (numResonators() values).
+    void updateConcurrent(const Real *frameData, size_t frameLength, size_t sampleStride, Real *powers = nullptr);
+
+    /// Batch (offline) mode.
+    /// Over a block of B samples, the state update is linear in the initial state and in the samples,
+    /// with weights that only depend on the bank's coefficients. prepareBatch() precomputes these weights,
+    /// updateBatch() then processes whole blocks as a matrix product (frames x B times B x 4N).
+    void prepareBatch(size_t blockSize);
+    size_t batchBlockSize() const { return m_batchBlockSize; }
+    /// Process the samples in blocks of batchBlockSize() samples (trailing samples are processed sample by sample).
+    /// If powers is not null, it receives the powers after each complete block, one row of numResonators() values per block.
+    void updateBatch(const Real *data, size_t length, size_t sampleStride, Real *powers);
+
+    /// Time-parallel offline mode.
+    /// The smoothed resonance forgets its initial state exponentially: a segment of the signal can be processed
+    /// independently, starting from a zero state warmUpLength() samples before the segment.
+    /// Number of warm-up samples after which the error due to the unknown initial state is below tolerance
+    /// (relative to the amplitude of the signal), for the smallest alpha and beta of the bank.
+    size_t warmUpLength(Real tolerance) const;
+    /// Same results as update(data, length, sampleStride, outputInterval, powers, amplitudes), within tolerance:
+    /// the samples are split into segments (one per thread, see setNumThreads()), each processed in parallel by its own
+    /// bank (sharing this bank's tables) after a warm-up, and the outputs are written in place.
+    /// The first segment continues from this bank's state, which is left as the state at the end of the samples
+    /// (phasor resync included: each segment bank resyncs its phasors from the exact phases at its start).
+    /// A single snapshot is published, at the end.
+    size_t updateParallel(const Real *data, size_t length, size_t sampleStride, size_t outputInterval,
+                          Real *powers, Real *amplitudes, Real tolerance);
+
+    /// Checkpoint (see Checkpoint.hpp) of the configuration (frequencies, alphas, betas, silence threshold,
+    /// phasor resync mode) and of the state (R, RR, phasors, tracking phases, output and resync counters).
+    /// Runtime settings (threads, kernel variant, snapshots, batch mode) are not included.
+    /// A checkpoint is restored into a bank with the same number of resonators and sample rate, by copying the arrays:
+    /// only the coefficients of the resonators with a different configuration are recomputed.
+    size_t checkpointSize() const;
+    /// Returns the number of bytes written (checkpointSize())
+    size_t saveCheckpoint(void *data, size_t size) const;
+    void restoreCheckpoint(const void *data, size_t size);
+    /// Bank restored from a checkpoint
+    ResonatorBankVecT(const void *checkpoint, size_t size);
 };
 
+extern template class ResonatorBankVecT<float>;
+extern template class ResonatorBankVecT<double>;
+
+using ResonatorBankVec = ResonatorBankVecT<float>;
+using ResonatorBankVecDouble = ResonatorBankVecT<double>;
+
 } // oscillators_cpp
 
 #endif /* ResonatorBankVec_hpp */
@@ -32,8 +32,22 @@ using namespace oscillators_cpp;
 
 @interface ResonatorBankVecCpp()
 @property oscillators_cpp::ResonatorBankVec *resonatorBank;
+@property oscillators_cpp::Arena *arena;
 @end
 
+namespace {
+
+void copyPrecisionReport(const CoefficientPrecisionReport &precisionReport, float *report) {
+    report[0] = precisionReport.maxFrequencyError;
+    report[1] = precisionReport.maxRelativeFrequencyError;
+    report[2] = precisionReport.maxAlphaError;
+    report[3] = precisionReport.maxBetaError;
+    report[4] = precisionReport.maxPowerError;
+    report[5] = precisionReport.meanPowerError;
+}
+
+} // namespace
+
 @implementation ResonatorBankVecCpp
 
 - (instancetype)initWithNumResonators:(int)numResonators frequencies:(const float*)frequencies alphas:(const float*)alphas betas:(const float*)betas sampleRate:(float)sampleRate {
@@ -43,8 +57,28 @@ using namespace oscillators_cpp;
     return self;
 }
 
+- (instancetype)initWithNumResonators:(int)numResonators frequencies:(const float*)frequencies alphas:(const float*)alphas betas:(const float*)betas sampleRate:(float)sampleRate arena:(void*)arena arenaSize:(int)arenaSize {
+    if (self = [super init]) {
+        self.arena = new Arena(arena, arenaSize);
+        self.resonatorBank = new ResonatorBankVec(numResonators, frequencies, alphas, betas, sampleRate, *self.arena);
+    }
+    return self;
+}
+
+- (instancetype)initWithCheckpoint:(const void*)checkpoint size:(int)size {
+    if (self = [super init]) {
+        self.resonatorBank = new ResonatorBankVec(checkpoint, size);
+    }
+    return self;
+}
+
++ (int)arenaSize:(int)numResonators {
+    return static_cast<int>(ResonatorBankVec::arenaSize(numResonators));
+}
+
 - (void)dealloc {
     delete self.resonatorBank;
+    delete self.arena;
 }
 
 - (float)sampleRate {
@@ -67,6 +101,66 @@ using namespace oscillators_cpp;
     return self.resonatorBank->betaValue(index);
 }
 
+- (float)phaseValue:(int)index {
+    return self.resonatorBank->phaseValue(index);
+}
+
+- (void)setAllAlphas:(float)alpha {
+    self.resonatorBank->setAllAlphas(alpha);
+}
+
+- (void)setFrequency:(int)index frequency:(float)frequency {
+    self.resonatorBank->setFrequency(index, frequency);
+}
+
+- (void)setAlpha:(int)index alpha:(float)alpha {
+    self.resonatorBank->setAlpha(index, alpha);
+}
+
+- (void)setBeta:(int)index beta:(float)beta {
+    self.resonatorBank->setBeta(index, beta);
+}
+
+- (void)insertResonator:(int)index frequency:(float)frequency alpha:(float)alpha beta:(float)beta {
+    self.resonatorBank->insertResonator(index, frequency, alpha, beta);
+}
+
+- (void)removeResonator:(int)index {
+    self.resonatorBank->removeResonator(index);
+}
+
+- (int)capacity {
+    return static_cast<int>(self.resonatorBank->capacity());
+}
+
+- (NSString*)kernelVariantName {
+    return [NSString stringWithUTF8String:oscillators_cpp::kernelVariantName(self.resonatorBank->kernelVariant())];
+}
+
+- (void)setFloat32Coefficients {
+    self.resonatorBank->setCoefficientPrecision(CoefficientPrecision::Float32);
+}
+
+- (void)setFloat16Coefficients {
+    self.resonatorBank->setCoefficientPrecision(CoefficientPrecision::Float16);
+}
+
+- (void)setBFloat16Coefficients {
+    self.resonatorBank->setCoefficientPrecision(CoefficientPrecision::BFloat16);
+}
+
+- (NSString*)coefficientPrecisionName {
+    return [NSString stringWithUTF8String:oscillators_cpp::coefficientPrecisionName(self.resonatorBank->coefficientPrecision())];
+}
+
+- (void)getFloat16PrecisionReport:(float*)report samples:(const float*)samples numSamples:(int)numSamples hop:(int)hop {
+    copyPrecisionReport(self.resonatorBank->precisionReport(CoefficientPrecision::Float16, samples, numSamples, hop), report);
+}
+
+- (void)getBFloat16PrecisionReport:(float*)report samples:(const float*)samples numSamples:(int)numSamples hop:(int)hop {
+    copyPrecisionReport(self.resonatorBank->precisionReport(CoefficientPrecision::BFloat16, samples, numSamples, hop), report);
+}
+
 - (void)getPowers:(float*)dest size: (int)size {
     self.resonatorBank->getPowers(dest, size);
 }
@@ -91,8 +185,100 @@ using namespace oscillators_cpp;
     self.resonatorBank->update(frame, frameLength, sampleStride);
 }
 
+- (void)updateInt16:(const int16_t*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride scale:(float)scale {
+    self.resonatorBank->update(frame, PCMFormat::Int16, frameLength, sampleStride, scale);
+}
+
+- (void)updateInt24:(const void*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride scale:(float)scale {
+    self.resonatorBank->update(frame, PCMFormat::Int24, frameLength, sampleStride, scale);
+}
+
+- (void)updateInt32:(const int32_t*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride scale:(float)scale {
+    self.resonatorBank->update(frame, PCMFormat::Int32, frameLength, sampleStride, scale);
+}
+
 - (void)update:(float*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride powers:(float*)powers amplitudes:(float*)amplitudes {
     self.resonatorBank->update(frame, frameLength, sampleStride, powers, amplitudes);
 }
 
+- (int)update:(float*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride outputInterval:(int)outputInterval powers:(float*)powers amplitudes:(float*)amplitudes {
+    return static_cast<int>(self.resonatorBank->update(frame, frameLength, sampleStride, outputInterval, powers, amplitudes));
+}
+
+- (void)updateAndTrack:(float*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride trackedFrequencies:(float*)trackedFrequencies {
+    self.resonatorBank->updateAndTrack(frame, frameLength, sampleStride, trackedFrequencies);
+}
+
+- (void)setSilenceThreshold:(float)threshold {
+    self.resonatorBank->setSilenceThreshold(threshold);
+}
+
+- (float)silenceThreshold {
+    return self.resonatorBank->silenceThreshold();
+}
+
+- (void)setPhasorResync:(bool)enabled resyncInterval:(int)resyncInterval {
+    self.resonatorBank->setPhasorResync(enabled, resyncInterval);
+}
+
+- (bool)phasorResync {
+    return self.resonatorBank->phasorResync();
+}
+
+- (int)resyncInterval {
+    return static_cast<int>(self.resonatorBank->resyncInterval());
+}
+
+- (void)setNumThreads:(int)numThreads {
+    self.resonatorBank->setNumThreads(numThreads);
+}
+
+- (int)numThreads {
+    return static_cast<int>(self.resonatorBank->numThreads());
+}
+
+- (void)updateConcurrent:(float*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride powers:(float*)powers {
+    self.resonatorBank->updateConcurrent(frame, frameLength, sampleStride, powers);
+}
+
+- (void)prepareBatch:(int)blockSize {
+    self.resonatorBank->prepareBatch(blockSize);
+}
+
+- (void)updateBatch:(float*)data length:(int)length sampleStride:(int)sampleStride powers:(float*)powers {
+    self.resonatorBank->updateBatch(data, length, sampleStride, powers);
+}
+
+- (int)warmUpLength:(float)tolerance {
+    return static_cast<int>(self.resonatorBank->warmUpLength(tolerance));
+}
+
+- (int)updateParallel:(float*)data length:(int)length sampleStride:(int)sampleStride outputInterval:(int)outputInterval powers:(float*)powers amplitudes:(float*)amplitudes tolerance:(float)tolerance {
+    return static_cast<int>(self.resonatorBank->updateParallel(data, length, sampleStride, outputInterval, powers, amplitudes, tolerance));
+}
+
+- (void)setSnapshotsEnabled:(bool)enabled {
+    self.resonatorBank->setSnapshotsEnabled(enabled);
+}
+
+- (bool)snapshotsEnabled {
+    return self.resonatorBank->snapshotsEnabled();
+}
+
+- (int)getSnapshotPowers:(float*)powers amplitudes:(float*)amplitudes phases:(float*)phases size:(int)size {
+    return static_cast<int>(self.resonatorBank->getSnapshot(powers, amplitudes, phases, size));
+}
+
+- (int)checkpointSize {
+    return static_cast<int>(self.resonatorBank->checkpointSize());
+}
+
+- (int)saveCheckpoint:(void*)data size:(int)size {
+    return static_cast<int>(self.resonatorBank->saveCheckpoint(data, size));
+}
+
+- (void)restoreCheckpoint:(const void*)data size:(int)size {
+    self.resonatorBank->restoreCheckpoint(data, size);
+}
+
 @end
@@ -0,0 +1,241 @@
+/**
+MIT License
+
+Copyright (c) 2024-2025 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#import "ResonatorBankVecDoubleCpp.h"
+
+#import <Foundation/Foundation.h>
+
+#include "ResonatorBankVec.hpp"
+
+using namespace oscillators_cpp;
+
+@interface ResonatorBankVecDoubleCpp()
+@property oscillators_cpp::ResonatorBankVecDouble *resonatorBank;
+@end
+
+@implementation ResonatorBankVecDoubleCpp
+
+- (instancetype)initWithNumResonators:(int)numResonators frequencies:(const double*)frequencies alphas:(const double*)alphas betas:(const double*)betas sampleRate:(double)sampleRate {
+    if (self = [super init]) {
+        self.resonatorBank = new ResonatorBankVecDouble(numResonators, frequencies, alphas, betas, sampleRate);
+    }
+    return self;
+}
+
+- (instancetype)initWithCheckpoint:(const void*)checkpoint size:(int)size {
+    if (self = [super init]) {
+        self.resonatorBank = new ResonatorBankVecDouble(checkpoint, size);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    delete self.resonatorBank;
+}
+
+- (double)sampleRate {
+    return self.resonatorBank->sampleRate();
+}
+
+- (int)numResonators {
+    return static_cast<int>(self.resonatorBank->numResonators());
+}
+
+- (double)frequencyValue:(int)index {
+    return self.resonatorBank->frequencyValue(index);
+}
+
+- (double)alphaValue:(int)index {
+    return self.resonatorBank->alphaValue(index);
+}
+
+- (double)betaValue:(int)index {
+    return self.resonatorBank->betaValue(index);
+}
+
+- (double)phaseValue:(int)index {
+    return self.resonatorBank->phaseValue(index);
+}
+
+- (void)setAllAlphas:(double)alpha {
+    self.resonatorBank->setAllAlphas(alpha);
+}
+
+- (void)setFrequency:(int)index frequency:(double)frequency {
+    self.resonatorBank->setFrequency(index, frequency);
+}
+
+- (void)setAlpha:(int)index alpha:(double)alpha {
+    self.resonatorBank->setAlpha(index, alpha);
+}
+
+- (void)setBeta:(int)index beta:(double)beta {
+    self.resonatorBank->setBeta(index, beta);
+}
+
+- (void)insertResonator:(int)index frequency:(double)frequency alpha:(double)alpha beta:(double)beta {
+    self.resonatorBank->insertResonator(index, frequency, alpha, beta);
+}
+
+- (void)removeResonator:(int)index {
+    self.resonatorBank->removeResonator(index);
+}
+
+- (int)capacity {
+    return static_cast<int>(self.resonatorBank->capacity());
+}
+
+- (NSString*)kernelVariantName {
+    return [NSString stringWithUTF8String:oscillators_cpp::kernelVariantName(self.resonatorBank->kernelVariant())];
+}
+
+- (void)setFloat32Coefficients {
+    self.resonatorBank->setCoefficientPrecision(CoefficientPrecision::Float32);
+}
+
+- (void)setFloat16Coefficients {
+    self.resonatorBank->setCoefficientPrecision(CoefficientPrecision::Float16);
+}
+
+- (void)setBFloat16Coefficients {
+    self.resonatorBank->setCoefficientPrecision(CoefficientPrecision::BFloat16);
+}
+
+- (NSString*)coefficientPrecisionName {
+    return [NSString stringWithUTF8String:oscillators_cpp::coefficientPrecisionName(self.resonatorBank->coefficientPrecision())];
+}
+
+- (void)getPowers:(double*)dest size: (int)size {
+    self.resonatorBank->getPowers(dest, size);
+}
+
+- (void)getAmplitudes:(double*)dest size: (int)size {
+    self.resonatorBank->getAmplitudes(dest, size);
+}
+
+- (void)update:(double)sample {
+    self.resonatorBank->update(sample);
+}
+
+- (void)update:(double*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride {
+    self.resonatorBank->update(frame, frameLength, sampleStride);
+}
+
+- (void)updateInt16:(const int16_t*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride scale:(float)scale {
+    self.resonatorBank->update(frame, PCMFormat::Int16, frameLength, sampleStride, scale);
+}
+
+- (void)updateInt24:(const void*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride scale:(float)scale {
+    self.resonatorBank->update(frame, PCMFormat::Int24, frameLength, sampleStride, scale);
+}
+
+- (void)updateInt32:(const int32_t*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride scale:(float)scale {
+    self.resonatorBank->update(frame, PCMFormat::Int32, frameLength, sampleStride, scale);
+}
+
+- (void)update:(double*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride powers:(double*)powers amplitudes:(double*)amplitudes {
+    self.resonatorBank->update(frame, frameLength, sampleStride, powers, amplitudes);
+}
+
+- (int)update:(double*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride outputInterval:(int)outputInterval powers:(double*)powers amplitudes:(double*)amplitudes {
+    return static_cast<int>(self.resonatorBank->update(frame, frameLength, sampleStride, outputInterval, powers, amplitudes));
+}
+
+- (void)updateAndTrack:(double*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride trackedFrequencies:(double*)trackedFrequencies {
+    self.resonatorBank->updateAndTrack(frame, frameLength, sampleStride, trackedFrequencies);
+}
+
+- (void)setSilenceThreshold:(double)threshold {
+    self.resonatorBank->setSilenceThreshold(threshold);
+}
+
+- (double)silenceThreshold {
+    return self.resonatorBank->silenceThreshold();
+}
+
+- (void)setPhasorResync:(bool)enabled resyncInterval:(int)resyncInterval {
+    self.resonatorBank->setPhasorResync(enabled, resyncInterval);
+}
+
+- (bool)phasorResync {
+    return self.resonatorBank->phasorResync();
+}
+
+- (int)resyncInterval {
+    return static_cast<int>(self.resonatorBank->resyncInterval());
+}
+
+- (void)setNumThreads:(int)numThreads {
+    self.resonatorBank->setNumThreads(numThreads);
+}
+
+- (int)numThreads {
+    return static_cast<int>(self.resonatorBank->numThreads());
+}
+
+- (void)updateConcurrent:(double*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride powers:(double*)powers {
+    self.resonatorBank->updateConcurrent(frame, frameLength, sampleStride, powers);
+}
+
+- (void)prepareBatch:(int)blockSize {
+    self.resonatorBank->prepareBatch(blockSize);
+}
+
+- (void)updateBatch:(double*)data length:(int)length sampleStride:(int)sampleStride powers:(double*)powers {
+    self.resonatorBank->updateBatch(data, length, sampleStride, powers);
+}
+
+- (int)warmUpLength:(double)tolerance {
+    return static_cast<int>(self.resonatorBank->warmUpLength(tolerance));
+}
+
+- (int)updateParallel:(double*)data length:(int)length sampleStride:(int)sampleStride outputInterval:(int)outputInterval powers:(double*)powers amplitudes:(double*)amplitudes tolerance:(double)tolerance {
+    return static_cast<int>(self.resonatorBank->updateParallel(data, length, sampleStride, outputInterval, powers, amplitudes, tolerance));
+}
+
+- (void)setSnapshotsEnabled:(bool)enabled {
+    self.resonatorBank->setSnapshotsEnabled(enabled);
+}
+
+- (bool)snapshotsEnabled {
+    return self.resonatorBank->snapshotsEnabled();
+}
+
+- (int)getSnapshotPowers:(float*)powers amplitudes:(float*)amplitudes phases:(float*)phases size:(int)size {
+    return static_cast<int>(self.resonatorBank->getSnapshot(powers, amplitudes, phases, size));
+}
+
+- (int)checkpointSize {
+    return static_cast<int>(self.resonatorBank->checkpointSize());
+}
+
+- (int)saveCheckpoint:(void*)data size:(int)size {
+    return static_cast<int>(self.resonatorBank->saveCheckpoint(data, size));
+}
+
+- (void)restoreCheckpoint:(const void*)data size:(int)size {
+    self.resonatorBank->restoreCheckpoint(data, size);
+}
+
+@end
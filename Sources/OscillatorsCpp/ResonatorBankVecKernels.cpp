@@ -0,0 +1,729 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "ResonatorBankVecKernels.hpp"
+#include "Float16.hpp"
+#include "VectorOps.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <stdexcept>
+
+// contract a * b + c into FMA instructions where the target supports them
+// (GCC does this by default, Clang only within expressions)
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT ON
+#endif
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define OSCILLATORS_X86_DISPATCH
+#define OSCILLATORS_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+using namespace oscillators_cpp;
+
+namespace {
+
+// Kernel bodies, instantiated below for each instruction set variant.
+// They are force-inlined in the variant functions so that they are compiled for the variant's target.
+
+/// Coefficients of the update kernel, loaded for a block of resonators (count in [1, B], the rest stays 0)
+template <typename Real>
+struct RealCoefficients {
+    size_t imagOffset;
+    const Real *w;
+    const Real *alphas;
+    const Real *omAlphas;
+    const Real *betas;
+    const Real *omBetas;
+
+    OSCILLATORS_ALWAYS_INLINE void load(size_t first, size_t count, Real *wRe, Real *wIm,
+                                        Real *a, Real *omA, Real *b, Real *omB) const {
+        for (size_t j=0; j<count; ++j) {
+            wRe[j] = w[first+j]; wIm[j] = w[imagOffset+first+j];
+            a[j] = alphas[first+j]; omA[j] = omAlphas[first+j];
+            b[j] = betas[first+j]; omB[j] = omBetas[first+j];
+        }
+    }
+};
+
+/// 16-bit coefficients, widened once per block and frame
+template <CoefficientPrecision Precision>
+struct WidenedCoefficients {
+    size_t imagOffset;
+    const ReducedCoefficients &reduced;
+
+    static OSCILLATORS_ALWAYS_INLINE float widen(uint16_t value) {
+        return Precision == CoefficientPrecision::Float16 ? halfToFloat(value) : bfloat16ToFloat(value);
+    }
+
+    template <typename Real>
+    OSCILLATORS_ALWAYS_INLINE void load(size_t first, size_t count, Real *wRe, Real *wIm,
+                                        Real *a, Real *omA, Real *b, Real *omB) const {
+        const uint16_t *alphas = reduced.alphas + first;
+        const uint16_t *betas = reduced.betas + first;
+        const uint16_t *w = reduced.w + first;
+        OSCILLATORS_VECTORIZE
+        for (size_t j=0; j<count; ++j) {
+            a[j] = widen(alphas[j]);
+            b[j] = widen(betas[j]);
+            omA[j] = Real(1) - a[j];
+            omB[j] = Real(1) - b[j];
+            const float re = widen(w[j]);
+            const float im = widen(w[imagOffset + j]);
+            // 1/|W| by two Newton iterations from 1 (|W| is within 1% of 1), without a square root that would prevent
+            // the vectorization of the loop with GCC (errno)
+            const float magnitude2 = re * re + im * im;
+            float norm = 1.5f - 0.5f * magnitude2;
+            norm *= 1.5f - 0.5f * magnitude2 * norm * norm;
+            wRe[j] = re * norm;
+            wIm[j] = im * norm;
+        }
+    }
+};
+
+/// Fused, time-blocked update.
+/// For each block of B resonators, load R, RR, Z, W and the coefficients once,
+/// iterate over all the samples of the frame, then write the state back once.
+/// The last (partial) block is padded with zero coefficients. Coefficients provides the load() of the coefficients of a block.
+/// With Output, the powers and/or amplitudes of the block are also written after sample firstOutput - 1
+/// and then every outputInterval samples, one row of outputStride values per output.
+template <size_t B, bool Output, typename Real, typename Coefficients>
+OSCILLATORS_ALWAYS_INLINE void updateBody(size_t numResonators, size_t imagOffset,
+                                          Real *r, Real *rr, Real *z, const Coefficients &coefficients,
+                                          const Real *frameData, size_t frameLength, size_t sampleStride,
+                                          size_t outputInterval = 0, size_t firstOutput = 0,
+                                          Real *powers = nullptr, Real *amplitudes = nullptr, size_t outputStride = 0) {
+    for (size_t first = 0; first < numResonators; first += B) {
+        const size_t count = std::min(B, numResonators - first);
+        const size_t re = first;
+        const size_t im = imagOffset + first;
+
+        Real rRe[B] = {}, rIm[B] = {}, rrRe[B] = {}, rrIm[B] = {};
+        Real zRe[B] = {}, zIm[B] = {}, wRe[B] = {}, wIm[B] = {};
+        Real a[B] = {}, omA[B] = {}, b[B] = {}, omB[B] = {};
+        for (size_t j=0; j<count; ++j) {
+            rRe[j] = r[re+j]; rIm[j] = r[im+j];
+            rrRe[j] = rr[re+j]; rrIm[j] = rr[im+j];
+            zRe[j] = z[re+j]; zIm[j] = z[im+j];
+        }
+        coefficients.load(first, count, wRe, wIm, a, omA, b, omB);
+
+        size_t countdown = firstOutput;
+        size_t outputRow = 0;
+        for (size_t i=0; i<frameLength; i += sampleStride) {
+            const Real sample = frameData[i];
+            OSCILLATORS_VECTORIZE
+            for (size_t j=0; j<B; ++j) {
+                // resonator: (1-alpha) * r + (alpha * s) * z
+                const Real alphaSample = a[j] * sample;
+                rRe[j] = omA[j] * rRe[j] + alphaSample * zRe[j];
+                rIm[j] = omA[j] * rIm[j] + alphaSample * zIm[j];
+                // smoothing with betas
+                rrRe[j] = omB[j] * rrRe[j] + b[j] * rRe[j];
+                rrIm[j] = omB[j] * rrIm[j] + b[j] * rIm[j];
+                // phasor
+                const Real zr = zRe[j] * wRe[j] - zIm[j] * wIm[j];
+                const Real zi = zRe[j] * wIm[j] + zIm[j] * wRe[j];
+                zRe[j] = zr;
+                zIm[j] = zi;
+            }
+            if constexpr (Output) {
+                if (--countdown == 0) {
+                    countdown = outputInterval;
+                    Real power[B];
+                    OSCILLATORS_VECTORIZE
+                    for (size_t j=0; j<B; ++j) {
+                        power[j] = rrRe[j] * rrRe[j] + rrIm[j] * rrIm[j];
+                    }
+                    if (powers) {
+                        Real *row = powers + outputRow * outputStride + first;
+                        for (size_t j=0; j<count; ++j) {
+                            row[j] = power[j];
+                        }
+                    }
+                    if (amplitudes) {
+                        Real *row = amplitudes + outputRow * outputStride + first;
+                        for (size_t j=0; j<count; ++j) {
+                            row[j] = std::sqrt(power[j]);
+                        }
+                    }
+                    ++outputRow;
+                }
+            }
+        }
+
+        for (size_t j=0; j<count; ++j) {
+            r[re+j] = rRe[j]; r[im+j] = rIm[j];
+            rr[re+j] = rrRe[j]; rr[im+j] = rrIm[j];
+            z[re+j] = zRe[j]; z[im+j] = zIm[j];
+        }
+    }
+}
+
+/// Update with 16-bit coefficients, for their precision
+template <size_t B, bool Output, typename Real>
+OSCILLATORS_ALWAYS_INLINE void updateReducedBody(size_t numResonators, size_t imagOffset,
+                                                 Real *r, Real *rr, Real *z, const ReducedCoefficients &coefficients,
+                                                 const Real *frameData, size_t frameLength, size_t sampleStride,
+                                                 size_t outputInterval = 0, size_t firstOutput = 0,
+                                                 Real *powers = nullptr, Real *amplitudes = nullptr, size_t outputStride = 0) {
+    if (coefficients.precision == CoefficientPrecision::Float16) {
+        updateBody<B, Output>(numResonators, imagOffset, r, rr, z,
+                              WidenedCoefficients<CoefficientPrecision::Float16>{imagOffset, coefficients},
+                              frameData, frameLength, sampleStride, outputInterval, firstOutput, powers, amplitudes, outputStride);
+    } else {
+        updateBody<B, Output>(numResonators, imagOffset, r, rr, z,
+                              WidenedCoefficients<CoefficientPrecision::BFloat16>{imagOffset, coefficients},
+                              frameData, frameLength, sampleStride, outputInterval, firstOutput, powers, amplitudes, outputStride);
+    }
+}
+
+/// Multichannel update, blocked in resonators (B) and in samples (S).
+/// For each block of resonators, the phasors of S samples are computed once into a buffer,
+/// then each channel's R and RR are loaded, updated over these S samples reading the buffered phasors, and written back.
+/// The computations are those of updateBody for each channel.
+template <size_t B, size_t S, typename Real>
+OSCILLATORS_ALWAYS_INLINE void updateMultichannelBody(size_t numResonators, size_t imagOffset, size_t numChannels, size_t channelOffset,
+                                                      Real *r, Real *rr, Real *z, const RealCoefficients<Real> &coefficients,
+                                                      const Real *frameData, size_t numSamples, size_t sampleStride) {
+    for (size_t first = 0; first < numResonators; first += B) {
+        const size_t count = std::min(B, numResonators - first);
+        const size_t re = first;
+        const size_t im = imagOffset + first;
+
+        Real zRe[B] = {}, zIm[B] = {}, wRe[B] = {}, wIm[B] = {};
+        Real a[B] = {}, omA[B] = {}, b[B] = {}, omB[B] = {};
+        for (size_t j=0; j<count; ++j) {
+            zRe[j] = z[re+j]; zIm[j] = z[im+j];
+        }
+        coefficients.load(first, count, wRe, wIm, a, omA, b, omB);
+
+        for (size_t firstSample = 0; firstSample < numSamples; firstSample += S) {
+            const size_t blockLength = std::min(S, numSamples - firstSample);
+
+            // phasors of the block of samples, shared by all channels
+            Real zBlockRe[S][B], zBlockIm[S][B];
+            for (size_t i=0; i<blockLength; ++i) {
+                OSCILLATORS_VECTORIZE
+                for (size_t j=0; j<B; ++j) {
+                    zBlockRe[i][j] = zRe[j];
+                    zBlockIm[i][j] = zIm[j];
+                    const Real zr = zRe[j] * wRe[j] - zIm[j] * wIm[j];
+                    const Real zi = zRe[j] * wIm[j] + zIm[j] * wRe[j];
+                    zRe[j] = zr;
+                    zIm[j] = zi;
+                }
+            }
+
+            for (size_t c=0; c<numChannels; ++c) {
+                Real *rc = r + c * channelOffset;
+                Real *rrc = rr + c * channelOffset;
+                const Real *samples = frameData + firstSample * sampleStride + c;
+                Real rRe[B] = {}, rIm[B] = {}, rrRe[B] = {}, rrIm[B] = {};
+                for (size_t j=0; j<count; ++j) {
+                    rRe[j] = rc[re+j]; rIm[j] = rc[im+j];
+                    rrRe[j] = rrc[re+j]; rrIm[j] = rrc[im+j];
+                }
+                for (size_t i=0; i<blockLength; ++i) {
+                    const Real sample = samples[i * sampleStride];
+                    OSCILLATORS_VECTORIZE
+                    for (size_t j=0; j<B; ++j) {
+                        // resonator: (1-alpha) * r + (alpha * s) * z
+                        const Real alphaSample = a[j] * sample;
+                        rRe[j] = omA[j] * rRe[j] + alphaSample * zBlockRe[i][j];
+                        rIm[j] = omA[j] * rIm[j] + alphaSample * zBlockIm[i][j];
+                        // smoothing with betas
+                        rrRe[j] = omB[j] * rrRe[j] + b[j] * rRe[j];
+                        rrIm[j] = omB[j] * rrIm[j] + b[j] * rIm[j];
+                    }
+                }
+                for (size_t j=0; j<count; ++j) {
+                    rc[re+j] = rRe[j]; rc[im+j] = rIm[j];
+                    rrc[re+j] = rrRe[j]; rrc[im+j] = rrIm[j];
+                }
+            }
+        }
+
+        for (size_t j=0; j<count; ++j) {
+            z[re+j] = zRe[j]; z[im+j] = zIm[j];
+        }
+    }
+}
+
+template <typename Real>
+OSCILLATORS_ALWAYS_INLINE void stabilizeBody(size_t numResonators, size_t imagOffset, Real *z) {
+    Real *zRe = z;
+    Real *zIm = z + imagOffset;
+    OSCILLATORS_VECTORIZE
+    for (size_t i=0; i<numResonators; ++i) {
+        const Real k = Real(1) / std::sqrt(zRe[i] * zRe[i] + zIm[i] * zIm[i]);
+        zRe[i] *= k;
+        zIm[i] *= k;
+    }
+}
+
+template <typename Real>
+OSCILLATORS_ALWAYS_INLINE void powersBody(size_t numResonators, size_t imagOffset, const Real *rr, Real *dest) {
+    const Real *rrRe = rr;
+    const Real *rrIm = rr + imagOffset;
+    OSCILLATORS_VECTORIZE
+    for (size_t i=0; i<numResonators; ++i) {
+        dest[i] = rrRe[i] * rrRe[i] + rrIm[i] * rrIm[i];
+    }
+}
+
+template <typename Real>
+OSCILLATORS_ALWAYS_INLINE void amplitudesBody(size_t numResonators, size_t imagOffset, const Real *rr, Real *dest) {
+    const Real *rrRe = rr;
+    const Real *rrIm = rr + imagOffset;
+    OSCILLATORS_VECTORIZE
+    for (size_t i=0; i<numResonators; ++i) {
+        dest[i] = std::sqrt(rrRe[i] * rrRe[i] + rrIm[i] * rrIm[i]);
+    }
+}
+
+/// Branch-free atan2 approximation (max error 2e-6 radians): degree 11 odd polynomial for atan on [0, 1],
+/// then octant and quadrant corrections.
+/// Selections are written as blends with 0/1 masks (exact, one of the terms is 0): GCC does not if-convert
+/// floating point selects by default (-ftrapping-math), which would prevent the vectorization of the loop.
+OSCILLATORS_ALWAYS_INLINE float atan2Approx(float y, float x) {
+    const float ax = std::fabs(x);
+    const float ay = std::fabs(y);
+    const float swap = static_cast<float>(ay > ax);
+    const float t = (swap * ax + (1.0f - swap) * ay) / (swap * ay + (1.0f - swap) * ax + FLT_MIN);
+    const float t2 = t * t;
+    float p = -0.01172120f;
+    p = p * t2 + 0.05265332f;
+    p = p * t2 - 0.11643287f;
+    p = p * t2 + 0.19354346f;
+    p = p * t2 - 0.33262347f;
+    p = p * t2 + 0.99997726f;
+    float a = p * t;
+    a = swap * 1.57079632679489662f + (1.0f - 2.0f * swap) * a;
+    const float left = static_cast<float>(x < 0.0f);
+    a = left * 3.14159265358979324f + (1.0f - 2.0f * left) * a;
+    return std::copysign(a, y);
+}
+
+/// Phases in the kernels: atan2Approx in float, std::atan2 in double (the approximation would lose its precision)
+OSCILLATORS_ALWAYS_INLINE float atan2Real(float y, float x) {
+    return atan2Approx(y, x);
+}
+
+OSCILLATORS_ALWAYS_INLINE double atan2Real(double y, double x) {
+    return std::atan2(y, x);
+}
+
+template <typename Real>
+OSCILLATORS_ALWAYS_INLINE void phasesBody(size_t numResonators, size_t imagOffset, const Real *rr, Real *dest) {
+    const Real *rrRe = rr;
+    const Real *rrIm = rr + imagOffset;
+    OSCILLATORS_VECTORIZE
+    for (size_t i=0; i<numResonators; ++i) {
+        dest[i] = atan2Real(rrIm[i], rrRe[i]);
+    }
+}
+
+/// Frequency tracking, same computations as Resonator::updateTrackedFrequency() with masks:
+/// phase of RR, phase drift since the previous frame unwrapped to (-pi, pi],
+/// tracked frequency = frequency - drift * driftScale where the power is above powerThreshold, frequency elsewhere
+/// (the phase is only updated where the power is above the threshold)
+template <typename Real>
+OSCILLATORS_ALWAYS_INLINE void trackBody(size_t numResonators, size_t imagOffset, const Real *rr, const Real *frequencies,
+                                         Real powerThreshold, Real driftScale, Real *phases, Real *trackedFrequencies) {
+    constexpr Real pi = static_cast<Real>(3.14159265358979324);
+    constexpr Real twoPi = 2 * pi;
+    const Real *rrRe = rr;
+    const Real *rrIm = rr + imagOffset;
+    OSCILLATORS_VECTORIZE
+    for (size_t i=0; i<numResonators; ++i) {
+        const Real power = rrRe[i] * rrRe[i] + rrIm[i] * rrIm[i];
+        const Real tracked = static_cast<Real>(power > powerThreshold);
+        const Real phase = atan2Real(rrIm[i], rrRe[i]);
+        const Real previousPhase = phases[i];
+        Real drift = phase - previousPhase;
+        drift += twoPi * (static_cast<Real>(drift <= -pi) - static_cast<Real>(drift > pi));
+        phases[i] = tracked * phase + (Real(1) - tracked) * previousPhase;
+        trackedFrequencies[i] = tracked * (frequencies[i] - drift * driftScale) + (Real(1) - tracked) * frequencies[i];
+    }
+}
+
+/// Resonators per block: two registers per array, for registers of registerBytes bytes
+/// (generic and AVX2: 16 floats or 8 doubles, AVX-512: 32 floats or 16 doubles)
+template <typename Real, size_t registerBytes>
+constexpr size_t blockSize = 2 * registerBytes / sizeof(Real);
+
+// Generic variant
+
+template <typename Real>
+void updateGeneric(size_t numResonators, size_t imagOffset,
+                   Real *r, Real *rr, Real *z, const Real *w,
+                   const Real *alphas, const Real *omAlphas, const Real *betas, const Real *omBetas,
+                   const Real *frameData, size_t frameLength, size_t sampleStride) {
+    updateBody<blockSize<Real, 32>, false>(numResonators, imagOffset, r, rr, z, RealCoefficients<Real>{imagOffset, w, alphas, omAlphas, betas, omBetas}, frameData, frameLength, sampleStride);
+}
+
+template <typename Real>
+void updateOutputGeneric(size_t numResonators, size_t imagOffset,
+                         Real *r, Real *rr, Real *z, const Real *w,
+                         const Real *alphas, const Real *omAlphas, const Real *betas, const Real *omBetas,
+                         const Real *frameData, size_t frameLength, size_t sampleStride,
+                         size_t outputInterval, size_t firstOutput, Real *powers, Real *amplitudes, size_t outputStride) {
+    updateBody<blockSize<Real, 32>, true>(numResonators, imagOffset, r, rr, z, RealCoefficients<Real>{imagOffset, w, alphas, omAlphas, betas, omBetas}, frameData, frameLength, sampleStride,
+                                          outputInterval, firstOutput, powers, amplitudes, outputStride);
+}
+
+template <typename Real>
+void updateReducedGeneric(size_t numResonators, size_t imagOffset,
+                          Real *r, Real *rr, Real *z, const ReducedCoefficients &coefficients,
+                          const Real *frameData, size_t frameLength, size_t sampleStride) {
+    updateReducedBody<blockSize<Real, 32>, false>(numResonators, imagOffset, r, rr, z, coefficients, frameData, frameLength, sampleStride);
+}
+
+template <typename Real>
+void updateOutputReducedGeneric(size_t numResonators, size_t imagOffset,
+                                Real *r, Real *rr, Real *z, const ReducedCoefficients &coefficients,
+                                const Real *frameData, size_t frameLength, size_t sampleStride,
+                                size_t outputInterval, size_t firstOutput, Real *powers, Real *amplitudes, size_t outputStride) {
+    updateReducedBody<blockSize<Real, 32>, true>(numResonators, imagOffset, r, rr, z, coefficients, frameData, frameLength, sampleStride,
+                                                 outputInterval, firstOutput, powers, amplitudes, outputStride);
+}
+
+template <typename Real>
+void updateMultichannelGeneric(size_t numResonators, size_t imagOffset, size_t numChannels, size_t channelOffset,
+                               Real *r, Real *rr, Real *z, const Real *w,
+                               const Real *alphas, const Real *omAlphas, const Real *betas, const Real *omBetas,
+                               const Real *frameData, size_t numSamples, size_t sampleStride) {
+    updateMultichannelBody<blockSize<Real, 32>, 64>(numResonators, imagOffset, numChannels, channelOffset, r, rr, z,
+                                                    RealCoefficients<Real>{imagOffset, w, alphas, omAlphas, betas, omBetas}, frameData, numSamples, sampleStride);
+}
+
+template <typename Real>
+void stabilizeGeneric(size_t numResonators, size_t imagOffset, Real *z) {
+#ifdef OSCILLATORS_USE_ACCELERATE
+    Real *zRe = z;
+    Real *zIm = z + imagOffset;
+    // squared magnitudes, reciprocal square root, then scale (in place, through a small buffer)
+    constexpr size_t chunk = 256;
+    Real buffer[chunk];
+    for (size_t first = 0; first < numResonators; first += chunk) {
+        const size_t count = std::min(chunk, numResonators - first);
+        vops::squaredMagnitudes(zRe + first, zIm + first, buffer, count);
+        vops::rsqrt(buffer, buffer, count);
+        vops::complexRealMultiply(zRe + first, zIm + first, buffer, zRe + first, zIm + first, count);
+    }
+#else
+    stabilizeBody(numResonators, imagOffset, z);
+#endif
+}
+
+template <typename Real>
+void powersGeneric(size_t numResonators, size_t imagOffset, const Real *rr, Real *dest) {
+    vops::squaredMagnitudes(rr, rr + imagOffset, dest, numResonators);
+}
+
+template <typename Real>
+void amplitudesGeneric(size_t numResonators, size_t imagOffset, const Real *rr, Real *dest) {
+    vops::squaredMagnitudes(rr, rr + imagOffset, dest, numResonators);
+    vops::sqrt(dest, dest, numResonators);
+}
+
+template <typename Real>
+void phasesGeneric(size_t numResonators, size_t imagOffset, const Real *rr, Real *dest) {
+    phasesBody(numResonators, imagOffset, rr, dest);
+}
+
+template <typename Real>
+void trackGeneric(size_t numResonators, size_t imagOffset, const Real *rr, const Real *frequencies,
+                   Real powerThreshold, Real driftScale, Real *phases, Real *trackedFrequencies) {
+    trackBody(numResonators, imagOffset, rr, frequencies, powerThreshold, driftScale, phases, trackedFrequencies);
+}
+
+template <typename Real>
+void matrixMultiplyGeneric(const Real *a, size_t lda, const Real *b, size_t ldb, Real *c, size_t ldc,
+                           size_t m, size_t n, size_t k) {
+    vops::matrixMultiply(a, lda, b, ldb, c, ldc, m, n, k);
+}
+
+template <typename Real>
+constexpr ResonatorBankVecKernelsT<Real> genericKernels = {
+    KernelVariant::Generic, updateGeneric<Real>, updateOutputGeneric<Real>, updateReducedGeneric<Real>, updateOutputReducedGeneric<Real>, updateMultichannelGeneric<Real>, stabilizeGeneric<Real>, powersGeneric<Real>, amplitudesGeneric<Real>, phasesGeneric<Real>, trackGeneric<Real>, matrixMultiplyGeneric<Real>
+};
+
+#ifdef OSCILLATORS_X86_DISPATCH
+
+// AVX2 + FMA variant: 16 float or 8 double resonators per block (2 registers per array)
+
+template <typename Real>
+OSCILLATORS_TARGET("avx2,fma")
+void updateAVX2(size_t numResonators, size_t imagOffset,
+                Real *r, Real *rr, Real *z, const Real *w,
+                const Real *alphas, const Real *omAlphas, const Real *betas, const Real *omBetas,
+                const Real *frameData, size_t frameLength, size_t sampleStride) {
+    updateBody<blockSize<Real, 32>, false>(numResonators, imagOffset, r, rr, z, RealCoefficients<Real>{imagOffset, w, alphas, omAlphas, betas, omBetas}, frameData, frameLength, sampleStride);
+}
+
+template <typename Real>
+OSCILLATORS_TARGET("avx2,fma")
+void updateOutputAVX2(size_t numResonators, size_t imagOffset,
+                      Real *r, Real *rr, Real *z, const Real *w,
+                      const Real *alphas, const Real *omAlphas, const Real *betas, const Real *omBetas,
+                      const Real *frameData, size_t frameLength, size_t sampleStride,
+                      size_t outputInterval, size_t firstOutput, Real *powers, Real *amplitudes, size_t outputStride) {
+    updateBody<blockSize<Real, 32>, true>(numResonators, imagOffset, r, rr, z, RealCoefficients<Real>{imagOffset, w, alphas, omAlphas, betas, omBetas}, frameData, frameLength, sampleStride,
+                                          outputInterval, firstOutput, powers, amplitudes, outputStride);
+}
+
+template <typename Real>
+OSCILLATORS_TARGET("avx2,fma")
+void updateReducedAVX2(size_t numResonators, size_t imagOffset,
+                       Real *r, Real *rr, Real *z, const ReducedCoefficients &coefficients,
+                       const Real *frameData, size_t frameLength, size_t sampleStride) {
+    updateReducedBody<blockSize<Real, 32>, false>(numResonators, imagOffset, r, rr, z, coefficients, frameData, frameLength, sampleStride);
+}
+
+template <typename Real>
+OSCILLATORS_TARGET("avx2,fma")
+void updateOutputReducedAVX2(size_t numResonators, size_t imagOffset,
+                             Real *r, Real *rr, Real *z, const ReducedCoefficients &coefficients,
+                             const Real *frameData, size_t frameLength, size_t sampleStride,
+                             size_t outputInterval, size_t firstOutput, Real *powers, Real *amplitudes, size_t outputStride) {
+    updateReducedBody<blockSize<Real, 32>, true>(numResonators, imagOffset, r, rr, z, coefficients, frameData, frameLength, sampleStride,
+                                                 outputInterval, firstOutput, powers, amplitudes, outputStride);
+}
+
+template <typename Real>
+OSCILLATORS_TARGET("avx2,fma")
+void updateMultichannelAVX2(size_t numResonators, size_t imagOffset, size_t numChannels, size_t channelOffset,
+                            Real *r, Real *rr, Real *z, const Real *w,
+                            const Real *alphas, const Real *omAlphas, const Real *betas, const Real *omBetas,
+                            const Real *frameData, size_t numSamples, size_t sampleStride) {
+    updateMultichannelBody<blockSize<Real, 32>, 64>(numResonators, imagOffset, numChannels, channelOffset, r, rr, z,
+                                                    RealCoefficients<Real>{imagOffset, w, alphas, omAlphas, betas, omBetas}, frameData, numSamples, sampleStride);
+}
+
+template <typename Real>
+OSCILLATORS_TARGET("avx2,fma")
+void stabilizeAVX2(size_t numResonators, size_t imagOffset, Real *z) {
+    stabilizeBody(numResonators, imagOffset, z);
+}
+
+template <typename Real>
+OSCILLATORS_TARGET("avx2,fma")
+void powersAVX2(size_t numResonators, size_t imagOffset, const Real *rr, Real *dest) {
+    powersBody(numResonators, imagOffset, rr, dest);
+}
+
+template <typename Real>
+OSCILLATORS_TARGET("avx2,fma")
+void amplitudesAVX2(size_t numResonators, size_t imagOffset, const Real *rr, Real *dest) {
+    amplitudesBody(numResonators, imagOffset, rr, dest);
+}
+
+template <typename Real>
+OSCILLATORS_TARGET("avx2,fma")
+void phasesAVX2(size_t numResonators, size_t imagOffset, const Real *rr, Real *dest) {
+    phasesBody(numResonators, imagOffset, rr, dest);
+}
+
+template <typename Real>
+OSCILLATORS_TARGET("avx2,fma")
+void trackAVX2(size_t numResonators, size_t imagOffset, const Real *rr, const Real *frequencies,
+                Real powerThreshold, Real driftScale, Real *phases, Real *trackedFrequencies) {
+    trackBody(numResonators, imagOffset, rr, frequencies, powerThreshold, driftScale, phases, trackedFrequencies);
+}
+
+template <typename Real>
+OSCILLATORS_TARGET("avx2,fma")
+void matrixMultiplyAVX2(const Real *a, size_t lda, const Real *b, size_t ldb, Real *c, size_t ldc,
+                    size_t m, size_t n, size_t k) {
+    vops::matrixMultiplyLoops(a, lda, b, ldb, c, ldc, m, n, k);
+}
+
+template <typename Real>
+constexpr ResonatorBankVecKernelsT<Real> avx2Kernels = {
+    KernelVariant::AVX2, updateAVX2<Real>, updateOutputAVX2<Real>, updateReducedAVX2<Real>, updateOutputReducedAVX2<Real>, updateMultichannelAVX2<Real>, stabilizeAVX2<Real>, powersAVX2<Real>, amplitudesAVX2<Real>, phasesAVX2<Real>, trackAVX2<Real>, matrixMultiplyAVX2<Real>
+};
+
+// AVX-512F + FMA variant: 32 float or 16 double resonators per block (2 registers per array)
+
+template <typename Real>
+OSCILLATORS_TARGET("avx512f,avx2,fma")
+void updateAVX512(size_t numResonators, size_t imagOffset,
+                  Real *r, Real *rr, Real *z, const Real *w,
+                  const Real *alphas, const Real *omAlphas, const Real *betas, const Real *omBetas,
+                  const Real *frameData, size_t frameLength, size_t sampleStride) {
+    updateBody<blockSize<Real, 64>, false>(numResonators, imagOffset, r, rr, z, RealCoefficients<Real>{imagOffset, w, alphas, omAlphas, betas, omBetas}, frameData, frameLength, sampleStride);
+}
+
+template <typename Real>
+OSCILLATORS_TARGET("avx512f,avx2,fma")
+void updateOutputAVX512(size_t numResonators, size_t imagOffset,
+                        Real *r, Real *rr, Real *z, const Real *w,
+                        const Real *alphas, const Real *omAlphas, const Real *betas, const Real *omBetas,
+                        const Real *frameData, size_t frameLength, size_t sampleStride,
+                        size_t outputInterval, size_t firstOutput, Real *powers, Real *amplitudes, size_t outputStride) {
+    updateBody<blockSize<Real, 64>, true>(numResonators, imagOffset, r, rr, z, RealCoefficients<Real>{imagOffset, w, alphas, omAlphas, betas, omBetas}, frameData, frameLength, sampleStride,
+                                          outputInterval, firstOutput, powers, amplitudes, outputStride);
+}
+
+template <typename Real>
+OSCILLATORS_TARGET("avx512f,avx2,fma")
+void updateReducedAVX512(size_t numResonators, size_t imagOffset,
+                         Real *r, Real *rr, Real *z, const ReducedCoefficients &coefficients,
+                         const Real *frameData, size_t frameLength, size_t sampleStride) {
+    updateReducedBody<blockSize<Real, 64>, false>(numResonators, imagOffset, r, rr, z, coefficients, frameData, frameLength, sampleStride);
+}
+
+template <typename Real>
+OSCILLATORS_TARGET("avx512f,avx2,fma")
+void updateOutputReducedAVX512(size_t numResonators, size_t imagOffset,
+                               Real *r, Real *rr, Real *z, const ReducedCoefficients &coefficients,
+                               const Real *frameData, size_t frameLength, size_t sampleStride,
+                               size_t outputInterval, size_t firstOutput, Real *powers, Real *amplitudes, size_t outputStride) {
+    updateReducedBody<blockSize<Real, 64>, true>(numResonators, imagOffset, r, rr, z, coefficients, frameData, frameLength, sampleStride,
+                                                 outputInterval, firstOutput, powers, amplitudes, outputStride);
+}
+
+template <typename Real>
+OSCILLATORS_TARGET("avx512f,avx2,fma")
+void updateMultichannelAVX512(size_t numResonators, size_t imagOffset, size_t numChannels, size_t channelOffset,
+                              Real *r, Real *rr, Real *z, const Real *w,
+                              const Real *alphas, const Real *omAlphas, const Real *betas, const Real *omBetas,
+                              const Real *frameData, size_t numSamples, size_t sampleStride) {
+    updateMultichannelBody<blockSize<Real, 64>, 64>(numResonators, imagOffset, numChannels, channelOffset, r, rr, z,
+                                                    RealCoefficients<Real>{imagOffset, w, alphas, omAlphas, betas, omBetas}, frameData, numSamples, sampleStride);
+}
+
+template <typename Real>
+OSCILLATORS_TARGET("avx512f,avx2,fma")
+void stabilizeAVX512(size_t numResonators, size_t imagOffset, Real *z) {
+    stabilizeBody(numResonators, imagOffset, z);
+}
+
+template <typename Real>
+OSCILLATORS_TARGET("avx512f,avx2,fma")
+void powersAVX512(size_t numResonators, size_t imagOffset, const Real *rr, Real *dest) {
+    powersBody(numResonators, imagOffset, rr, dest);
+}
+
+template <typename Real>
+OSCILLATORS_TARGET("avx512f,avx2,fma")
+void amplitudesAVX512(size_t numResonators, size_t imagOffset, const Real *rr, Real *dest) {
+    amplitudesBody(numResonators, imagOffset, rr, dest);
+}
+
+template <typename Real>
+OSCILLATORS_TARGET("avx512f,avx2,fma")
+void phasesAVX512(size_t numResonators, size_t imagOffset, const Real *rr, Real *dest) {
+    phasesBody(numResonators, imagOffset, rr, dest);
+}
+
+template <typename Real>
+OSCILLATORS_TARGET("avx512f,avx2,fma")
+void trackAVX512(size_t numResonators, size_t imagOffset, const Real *rr, const Real *frequencies,
+                  Real powerThreshold, Real driftScale, Real *phases, Real *trackedFrequencies) {
+    trackBody(numResonators, imagOffset, rr, frequencies, powerThreshold, driftScale, phases, trackedFrequencies);
+}
+
+template <typename Real>
+OSCILLATORS_TARGET("avx512f,avx2,fma")
+void matrixMultiplyAVX512(const Real *a, size_t lda, const Real *b, size_t ldb, Real *c, size_t ldc,
+                          size_t m, size_t n, size_t k) {
+    vops::matrixMultiplyLoops(a, lda, b, ldb, c, ldc, m, n, k);
+}
+
+template <typename Real>
+constexpr ResonatorBankVecKernelsT<Real> avx512Kernels = {
+    KernelVariant::AVX512, updateAVX512<Real>, updateOutputAVX512<Real>, updateReducedAVX512<Real>, updateOutputReducedAVX512<Real>, updateMultichannelAVX512<Real>, stabilizeAVX512<Real>, powersAVX512<Real>, amplitudesAVX512<Real>, phasesAVX512<Real>, trackAVX512<Real>, matrixMultiplyAVX512<Real>
+};
+
+#endif
+
+} // namespace
+
+const char* oscillators_cpp::kernelVariantName(KernelVariant variant) {
+    switch (variant) {
+        case KernelVariant::Generic: return "Generic";
+        case KernelVariant::AVX2: return "AVX2";
+        case KernelVariant::AVX512: return "AVX512";
+    }
+    return "Unknown";
+}
+
+const char* oscillators_cpp::coefficientPrecisionName(CoefficientPrecision precision) {
+    switch (precision) {
+        case CoefficientPrecision::Float32: return "Float32";
+        case CoefficientPrecision::Float16: return "Float16";
+        case CoefficientPrecision::BFloat16: return "BFloat16";
+    }
+    return "Unknown";
+}
+
+bool oscillators_cpp::kernelVariantSupported(KernelVariant variant) {
+    switch (variant) {
+        case KernelVariant::Generic:
+            return true;
+#ifdef OSCILLATORS_X86_DISPATCH
+        case KernelVariant::AVX2:
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+        case KernelVariant::AVX512:
+            return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+        default:
+            return false;
+    }
+}
+
+KernelVariant oscillators_cpp::bestKernelVariant() {
+    static const KernelVariant best = [] {
+        if (kernelVariantSupported(KernelVariant::AVX512)) {
+            return KernelVariant::AVX512;
+        }
+        if (kernelVariantSupported(KernelVariant::AVX2)) {
+            return KernelVariant::AVX2;
+        }
+        return KernelVariant::Generic;
+    }();
+    return best;
+}
+
+template <typename Real>
+const ResonatorBankVecKernelsT<Real>& oscillators_cpp::kernels(KernelVariant variant) {
+    if (!kernelVariantSupported(variant)) {
+        OSCILLATORS_THROW(std::invalid_argument("Kernel variant not supported"));
+    }
+    switch (variant) {
+#ifdef OSCILLATORS_X86_DISPATCH
+        case KernelVariant::AVX2: return avx2Kernels<Real>;
+        case KernelVariant::AVX512: return avx512Kernels<Real>;
+#endif
+        default: return genericKernels<Real>;
+    }
+}
+
+template const ResonatorBankVecKernelsT<float>& oscillators_cpp::kernels<float>(KernelVariant variant);
+template const ResonatorBankVecKernelsT<double>& oscillators_cpp::kernels<double>(KernelVariant variant);
@@ -0,0 +1,134 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef ResonatorBankVecKernels_hpp
+#define ResonatorBankVecKernels_hpp
+
+#include <cstddef>
+#include <cstdint>
+
+namespace oscillators_cpp {
+
+/// Instruction set variants of the ResonatorBankVec kernels.
+/// Variants other than Generic are only available on x86 with GCC or Clang,
+/// and are selected at runtime from the CPU features.
+enum class KernelVariant {
+    Generic, // portable code, compiled for the baseline target (uses VectorOps where applicable)
+    AVX2,    // AVX2 + FMA
+    AVX512   // AVX-512F + FMA
+};
+
+const char* kernelVariantName(KernelVariant variant);
+
+/// Storage precision of the coefficients read by the update kernels (see ResonatorBankVec::setCoefficientPrecision())
+enum class CoefficientPrecision {
+    Float32,
+    Float16, // IEEE half precision: 11-bit significand, 5-bit exponent
+    BFloat16 // 8-bit significand, 8-bit exponent
+};
+
+const char* coefficientPrecisionName(CoefficientPrecision precision);
+
+/// Coefficients stored in 16 bits (Float16 or BFloat16), widened to float in registers by the update kernels:
+/// alphas, betas, and the phasor multipliers W (real parts, imaginary parts at imagOffset).
+/// 1-alpha and 1-beta are derived from alpha and beta (16 bits cannot represent them close to 1),
+/// and W is renormalized to unit magnitude.
+struct ReducedCoefficients {
+    CoefficientPrecision precision;
+    const uint16_t *alphas;
+    const uint16_t *betas;
+    const uint16_t *w;
+};
+
+/// Table of kernel functions for one instruction set variant.
+/// State arrays are non-interlaced: the kernels process numResonators consecutive resonators,
+/// with real parts in [0, numResonators) and imaginary parts in [imagOffset, imagOffset + numResonators).
+/// For a whole bank imagOffset is the bank's stride (its number of resonators, padded to a multiple of the largest block);
+/// a contiguous range of a larger bank is processed by offsetting the pointers to its first resonator and passing
+/// the bank's stride as imagOffset. Kernels process resonators in blocks of 16 (generic, AVX2) or 32 (AVX-512) floats,
+/// 8 or 16 doubles: when numResonators is a multiple of the block size, there are no partial blocks.
+/// Real is the precision of the samples, the state and the coefficients (float or double, see ResonatorBankVecT).
+template <typename Real>
+struct ResonatorBankVecKernelsT {
+    KernelVariant variant;
+
+    /// Fused update of R, RR and Z over a frame of samples
+    void (*update)(size_t numResonators, size_t imagOffset,
+                   Real *r, Real *rr, Real *z, const Real *w,
+                   const Real *alphas, const Real *omAlphas, const Real *betas, const Real *omBetas,
+                   const Real *frameData, size_t frameLength, size_t sampleStride);
+    /// Same as update, also writing the powers and/or amplitudes (if not null) after sample firstOutput - 1
+    /// of the frame and then every outputInterval samples, one row of outputStride values per output
+    void (*updateOutput)(size_t numResonators, size_t imagOffset,
+                         Real *r, Real *rr, Real *z, const Real *w,
+                         const Real *alphas, const Real *omAlphas, const Real *betas, const Real *omBetas,
+                         const Real *frameData, size_t frameLength, size_t sampleStride,
+                         size_t outputInterval, size_t firstOutput, Real *powers, Real *amplitudes, size_t outputStride);
+    /// update and updateOutput, with coefficients stored in 16 bits (widened to float, then to Real)
+    void (*updateReduced)(size_t numResonators, size_t imagOffset,
+                          Real *r, Real *rr, Real *z, const ReducedCoefficients &coefficients,
+                          const Real *frameData, size_t frameLength, size_t sampleStride);
+    void (*updateOutputReduced)(size_t numResonators, size_t imagOffset,
+                                Real *r, Real *rr, Real *z, const ReducedCoefficients &coefficients,
+                                const Real *frameData, size_t frameLength, size_t sampleStride,
+                                size_t outputInterval, size_t firstOutput, Real *powers, Real *amplitudes, size_t outputStride);
+    /// Fused update of numChannels states sharing the coefficients and the phasors (see ResonatorBankMultichannel):
+    /// the phasors are advanced once per block of samples, and reused for the update of R and RR of every channel.
+    /// The state of channel c is at r + c * channelOffset and rr + c * channelOffset, and reads the numSamples values
+    /// frameData[c + i * sampleStride]
+    void (*updateMultichannel)(size_t numResonators, size_t imagOffset, size_t numChannels, size_t channelOffset,
+                               Real *r, Real *rr, Real *z, const Real *w,
+                               const Real *alphas, const Real *omAlphas, const Real *betas, const Real *omBetas,
+                               const Real *frameData, size_t numSamples, size_t sampleStride);
+    /// Phasor norm correction
+    void (*stabilize)(size_t numResonators, size_t imagOffset, Real *z);
+    /// Squared magnitudes of RR
+    void (*powers)(size_t numResonators, size_t imagOffset, const Real *rr, Real *dest);
+    /// Magnitudes of RR
+    void (*amplitudes)(size_t numResonators, size_t imagOffset, const Real *rr, Real *dest);
+    /// Phases of RR (float: approximation, max error 2e-6 radians; double: exact)
+    void (*phases)(size_t numResonators, size_t imagOffset, const Real *rr, Real *dest);
+    /// Frequency tracking from the phase drift of RR over a frame (see ResonatorBankVec::updateAndTrack())
+    void (*track)(size_t numResonators, size_t imagOffset, const Real *rr, const Real *frequencies,
+                  Real powerThreshold, Real driftScale, Real *phases, Real *trackedFrequencies);
+    /// Matrix product c = a * b (row-major, c is m x n), used by the batch mode
+    void (*matrixMultiply)(const Real *a, size_t lda, const Real *b, size_t ldb, Real *c, size_t ldc,
+                           size_t m, size_t n, size_t k);
+};
+
+using ResonatorBankVecKernels = ResonatorBankVecKernelsT<float>;
+
+/// Whether the variant was compiled in and is supported by the CPU
+bool kernelVariantSupported(KernelVariant variant);
+
+/// The best supported variant, determined once from CPUID
+KernelVariant bestKernelVariant();
+
+/// Kernel table for a supported variant, in the precision Real (float or double)
+template <typename Real = float>
+const ResonatorBankVecKernelsT<Real>& kernels(KernelVariant variant);
+
+} // oscillators_cpp
+
+#endif /* ResonatorBankVecKernels_hpp */
@@ -40,6 +40,12 @@ using namespace oscillators_cpp;
     return self;
 }
 
+- (void)dealloc {
+    // Phasor's destructor is not virtual: delete as a Resonator (PhasorCpp's dealloc then deletes nullptr)
+    delete self.resonator;
+    self.oscillator = nullptr;
+}
+
 - (Resonator*)resonator {
     return (Resonator*)self.oscillator;
 }
@@ -114,4 +120,16 @@ using namespace oscillators_cpp;
     self.resonator->updateAndTrack(frame, frameLength, sampleStride);
 }
 
+- (int)checkpointSize {
+    return static_cast<int>(self.resonator->checkpointSize());
+}
+
+- (int)saveCheckpoint:(void*)data size:(int)size {
+    return static_cast<int>(self.resonator->saveCheckpoint(data, size));
+}
+
+- (void)restoreCheckpoint:(const void*)data size:(int)size {
+    self.resonator->restoreCheckpoint(data, size);
+}
+
 @end
@@ -0,0 +1,87 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "RingBuffer.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+using namespace oscillators_cpp;
+
+RingBuffer::RingBuffer(size_t capacity)
+: m_mask(0), m_writeIndex(0), m_readIndex(0) {
+    if (capacity == 0) {
+        throw std::invalid_argument("Bad capacity passed to RingBuffer()");
+    }
+    size_t roundedCapacity = 1;
+    while (roundedCapacity < capacity) {
+        roundedCapacity <<= 1;
+    }
+    m_buffer.assign(roundedCapacity, 0.0f);
+    m_mask = roundedCapacity - 1;
+}
+
+size_t RingBuffer::size() const {
+    return m_writeIndex.load(std::memory_order_acquire) - m_readIndex.load(std::memory_order_acquire);
+}
+
+size_t RingBuffer::space() const {
+    return capacity() - size();
+}
+
+size_t RingBuffer::write(const float *frameData, size_t frameLength, size_t sampleStride) {
+    const size_t writeIndex = m_writeIndex.load(std::memory_order_relaxed);
+    const size_t readIndex = m_readIndex.load(std::memory_order_acquire);
+    const size_t numSamples = (frameLength + sampleStride - 1) / sampleStride;
+    const size_t count = std::min(numSamples, capacity() - (writeIndex - readIndex));
+    float *buffer = m_buffer.data();
+    if (sampleStride == 1) {
+        const size_t first = writeIndex & m_mask;
+        const size_t firstPart = std::min(count, capacity() - first);
+        memcpy(buffer + first, frameData, firstPart * sizeof(float));
+        memcpy(buffer, frameData + firstPart, (count - firstPart) * sizeof(float));
+    } else {
+        for (size_t i=0; i<count; ++i) {
+            buffer[(writeIndex + i) & m_mask] = frameData[i * sampleStride];
+        }
+    }
+    // publish the samples
+    m_writeIndex.store(writeIndex + count, std::memory_order_release);
+    return count;
+}
+
+size_t RingBuffer::read(float *dest, size_t count) {
+    const size_t readIndex = m_readIndex.load(std::memory_order_relaxed);
+    const size_t writeIndex = m_writeIndex.load(std::memory_order_acquire);
+    count = std::min(count, writeIndex - readIndex);
+    const float *buffer = m_buffer.data();
+    const size_t first = readIndex & m_mask;
+    const size_t firstPart = std::min(count, capacity() - first);
+    memcpy(dest, buffer + first, firstPart * sizeof(float));
+    memcpy(dest + firstPart, buffer, (count - firstPart) * sizeof(float));
+    // release the space
+    m_readIndex.store(readIndex + count, std::memory_order_release);
+    return count;
+}
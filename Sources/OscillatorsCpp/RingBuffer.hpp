@@ -0,0 +1,69 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef RingBuffer_hpp
+#define RingBuffer_hpp
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace oscillators_cpp {
+
+/// Wait-free single-producer/single-consumer ring buffer of samples.
+/// One thread (e.g. a real-time audio callback) writes, another reads: neither ever blocks or allocates,
+/// the indices are exchanged with acquire/release atomics only.
+/// The capacity is rounded up to a power of 2.
+class RingBuffer {
+public:
+    RingBuffer & operator=(const RingBuffer&) = delete;
+    RingBuffer(const RingBuffer&) = delete;
+
+    RingBuffer(size_t capacity);
+
+    size_t capacity() const { return m_mask + 1; }
+    /// Number of samples available for reading (exact from the consumer, a lower bound from the producer)
+    size_t size() const;
+    /// Number of samples that can be written (exact from the producer, a lower bound from the consumer)
+    size_t space() const;
+
+    /// Producer: write the samples of a frame (every sampleStride values of frameData),
+    /// as many as fit; returns the number of samples written
+    size_t write(const float *frameData, size_t frameLength, size_t sampleStride);
+    /// Consumer: read up to count samples into dest; returns the number of samples read
+    size_t read(float *dest, size_t count);
+
+private:
+    std::vector<float> m_buffer;
+    size_t m_mask;
+
+    /// Total number of samples written, only modified by the producer (own cache line, to avoid false sharing)
+    alignas(64) std::atomic<size_t> m_writeIndex;
+    /// Total number of samples read, only modified by the consumer
+    alignas(64) std::atomic<size_t> m_readIndex;
+};
+
+} // oscillators_cpp
+
+#endif /* RingBuffer_hpp */
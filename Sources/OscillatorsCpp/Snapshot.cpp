@@ -0,0 +1,80 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "Snapshot.hpp"
+#include "VectorOps.hpp"
+
+#include <stdexcept>
+#include <thread>
+
+using namespace oscillators_cpp;
+
+Snapshot::Snapshot(size_t numFields, size_t fieldSize)
+: m_numFields(numFields), m_fieldSize(fieldSize), m_values(new std::atomic<float>[numFields * fieldSize]),
+m_version(0), m_sequence(0) {
+    if (numFields == 0) {
+        OSCILLATORS_THROW(std::invalid_argument("Bad numFields passed to Snapshot()"));
+    }
+    for (size_t i=0; i<numFields * fieldSize; ++i) {
+        m_values[i].store(0.0f, std::memory_order_relaxed);
+    }
+}
+
+void Snapshot::publish(const float *values, uint64_t version) {
+    const uint64_t sequence = m_sequence.load(std::memory_order_relaxed);
+    m_sequence.store(sequence + 1, std::memory_order_relaxed);
+    // the odd sequence must be visible before any of the values
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i=0; i<m_numFields * m_fieldSize; ++i) {
+        m_values[i].store(values[i], std::memory_order_relaxed);
+    }
+    m_version.store(version, std::memory_order_relaxed);
+    m_sequence.store(sequence + 2, std::memory_order_release);
+}
+
+uint64_t Snapshot::read(float *const *fields) const {
+    for (;;) {
+        const uint64_t sequence = m_sequence.load(std::memory_order_acquire);
+        if (sequence & 1) {
+            std::this_thread::yield();
+            continue;
+        }
+        for (size_t f=0; f<m_numFields; ++f) {
+            float *dest = fields[f];
+            if (!dest) {
+                continue;
+            }
+            const std::atomic<float> *values = m_values.get() + f * m_fieldSize;
+            for (size_t i=0; i<m_fieldSize; ++i) {
+                dest[i] = values[i].load(std::memory_order_relaxed);
+            }
+        }
+        const uint64_t version = m_version.load(std::memory_order_relaxed);
+        // the values must be read before checking that the sequence has not changed
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (m_sequence.load(std::memory_order_relaxed) == sequence) {
+            return version;
+        }
+    }
+}
@@ -0,0 +1,68 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef Snapshot_hpp
+#define Snapshot_hpp
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace oscillators_cpp {
+
+/// Lock-free published copy of a bank's results (seqlock), for concurrent readers.
+/// A single writer (the thread that updates the bank) publishes numFields arrays of fieldSize values after each frame,
+/// without ever waiting for readers; any number of readers copy the latest complete publication,
+/// retrying if a publication happened during the copy.
+/// The values are stored as relaxed atomics, so that concurrent accesses are well defined.
+class Snapshot {
+public:
+    Snapshot & operator=(const Snapshot&) = delete;
+    Snapshot(const Snapshot&) = delete;
+
+    Snapshot(size_t numFields, size_t fieldSize);
+
+    size_t numFields() const { return m_numFields; }
+    size_t fieldSize() const { return m_fieldSize; }
+
+    /// Writer: publish numFields x fieldSize values (field-major), tagged with version (which must not be 0)
+    void publish(const float *values, uint64_t version);
+
+    /// Reader: copy the fields of the latest publication into fields[i] (numFields pointers, null to skip a field).
+    /// Returns the version of the publication, 0 if nothing has been published yet.
+    uint64_t read(float *const *fields) const;
+
+private:
+    size_t m_numFields;
+    size_t m_fieldSize;
+    std::unique_ptr<std::atomic<float>[]> m_values;
+    std::atomic<uint64_t> m_version;
+    /// Odd while a publication is in progress
+    std::atomic<uint64_t> m_sequence;
+};
+
+} // oscillators_cpp
+
+#endif /* Snapshot_hpp */
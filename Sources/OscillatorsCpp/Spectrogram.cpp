@@ -0,0 +1,359 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "Spectrogram.hpp"
+#include "Float16.hpp"
+#include "VectorOps.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+using namespace oscillators_cpp;
+
+namespace {
+
+constexpr size_t spectrogramAlignment = 8;
+
+size_t padded(size_t size) {
+    return (size + spectrogramAlignment - 1) / spectrogramAlignment * spectrogramAlignment;
+}
+
+size_t valueSize(SpectrogramEncoding encoding) {
+    return encoding == SpectrogramEncoding::Float16 ? sizeof(uint16_t) : sizeof(uint8_t);
+}
+
+size_t tablesSize(size_t numResonators) {
+    return padded(3 * numResonators * sizeof(float));
+}
+
+/// Largest finite magnitude
+float maxMagnitude(const float *values, size_t count) {
+    float maxValue = 0.0f;
+    for (size_t i=0; i<count; ++i) {
+        const float magnitude = std::fabs(values[i]);
+        if (magnitude > maxValue && std::isfinite(magnitude)) {
+            maxValue = magnitude;
+        }
+    }
+    return maxValue;
+}
+
+/// Log8 codes 1...255 span the dynamic range in 254 steps below the reference (code 255)
+float log8Step(float dynamicRange) {
+    return dynamicRange / 254.0f;
+}
+
+void decodeLog8Table(float reference, float dynamicRange, float *table) {
+    const float step = log8Step(dynamicRange);
+    table[0] = 0.0f;
+    for (int code=1; code<256; ++code) {
+        table[code] = std::pow(10.0f, 0.1f * (reference - static_cast<float>(255 - code) * step));
+    }
+}
+
+} // namespace
+
+SpectrogramWriter::SpectrogramWriter(const std::string &path, const SpectrogramInfo &info) :
+    m_file(nullptr),
+    m_path(path),
+    m_info(info),
+    m_header(),
+    m_numPendingFrames(0),
+    m_offset(0),
+    m_numFrames(0)
+{
+    const size_t n = info.numResonators();
+    if (n == 0 || n > UINT32_MAX || info.alphas.size() != n || info.betas.size() != n) {
+        OSCILLATORS_THROW(std::invalid_argument("Bad spectrogram resonators"));
+    }
+    if (info.encoding != SpectrogramEncoding::Float16 && info.encoding != SpectrogramEncoding::Log8) {
+        OSCILLATORS_THROW(std::invalid_argument("Bad spectrogram encoding"));
+    }
+    if (info.framesPerChunk == 0 || info.framesPerChunk > UINT32_MAX || info.hop > UINT32_MAX ||
+        !(info.dynamicRange > 0.0f)) {
+        OSCILLATORS_THROW(std::invalid_argument("Bad spectrogram parameters"));
+    }
+
+    m_pending.resize(info.framesPerChunk * n);
+    m_encoded.resize(padded(info.framesPerChunk * n * valueSize(info.encoding)));
+
+    m_header.magic = spectrogramMagic;
+    m_header.version = spectrogramVersion;
+    m_header.encoding = static_cast<uint16_t>(info.encoding);
+    m_header.numResonators = static_cast<uint32_t>(n);
+    m_header.hop = static_cast<uint32_t>(info.hop);
+    m_header.sampleRate = info.sampleRate;
+    m_header.dynamicRange = info.dynamicRange;
+    m_header.framesPerChunk = static_cast<uint32_t>(info.framesPerChunk);
+
+    m_file = fopen(path.c_str(), "wb");
+    if (!m_file) {
+        OSCILLATORS_THROW(std::runtime_error("Cannot open " + path + ": " + strerror(errno)));
+    }
+    std::vector<float> tables(tablesSize(n) / sizeof(float) + 1, 0.0f);
+    std::copy(info.frequencies.begin(), info.frequencies.end(), tables.begin());
+    std::copy(info.alphas.begin(), info.alphas.end(), tables.begin() + n);
+    std::copy(info.betas.begin(), info.betas.end(), tables.begin() + 2 * n);
+    if (!write(&m_header, sizeof(m_header)) || !write(tables.data(), tablesSize(n))) {
+        finish();
+        OSCILLATORS_THROW(std::runtime_error("Cannot write " + path));
+    }
+}
+
+SpectrogramWriter::~SpectrogramWriter() {
+    finish();
+}
+
+void SpectrogramWriter::append(const float *frames, size_t numFrames) {
+    if (!m_file) {
+        OSCILLATORS_THROW(std::logic_error("Spectrogram writer closed"));
+    }
+    const size_t n = m_info.numResonators();
+    while (numFrames > 0) {
+        const size_t count = std::min(numFrames, m_info.framesPerChunk - m_numPendingFrames);
+        std::copy(frames, frames + count * n, m_pending.begin() + m_numPendingFrames * n);
+        m_numPendingFrames += count;
+        frames += count * n;
+        numFrames -= count;
+        if (m_numPendingFrames == m_info.framesPerChunk && !writeChunk()) {
+            OSCILLATORS_THROW(std::runtime_error("Cannot write " + m_path));
+        }
+    }
+}
+
+void SpectrogramWriter::flush() {
+    if (!m_file) {
+        OSCILLATORS_THROW(std::logic_error("Spectrogram writer closed"));
+    }
+    if (!writeChunk() || fflush(m_file) != 0) {
+        OSCILLATORS_THROW(std::runtime_error("Cannot write " + m_path));
+    }
+}
+
+void SpectrogramWriter::close() {
+    if (m_file && !finish()) {
+        OSCILLATORS_THROW(std::runtime_error("Cannot write " + m_path));
+    }
+}
+
+bool SpectrogramWriter::finish() {
+    if (!m_file) {
+        return true;
+    }
+    bool success = writeChunk();
+    if (success && m_info.index && !m_index.empty()) {
+        const uint64_t indexOffset = m_offset;
+        success = write(m_index.data(), m_index.size() * sizeof(SpectrogramIndexEntry));
+        m_header.indexOffset = indexOffset;
+    }
+    if (success) {
+        m_header.numFrames = m_numFrames;
+        m_header.numChunks = m_index.size();
+        success = fseek(m_file, 0, SEEK_SET) == 0 && fwrite(&m_header, sizeof(m_header), 1, m_file) == 1;
+    }
+    success = fclose(m_file) == 0 && success;
+    m_file = nullptr;
+    return success;
+}
+
+bool SpectrogramWriter::write(const void *data, size_t size) {
+    if (fwrite(data, 1, size, m_file) != size) {
+        return false;
+    }
+    m_offset += size;
+    return true;
+}
+
+bool SpectrogramWriter::writeChunk() {
+    if (m_numPendingFrames == 0) {
+        return true;
+    }
+    const size_t count = m_numPendingFrames * m_info.numResonators();
+    const float maxValue = maxMagnitude(m_pending.data(), count);
+    SpectrogramChunkHeader chunk;
+    chunk.numFrames = static_cast<uint32_t>(m_numPendingFrames);
+    chunk.firstFrame = m_numFrames;
+    size_t payloadSize;
+    if (m_info.encoding == SpectrogramEncoding::Float16) {
+        // power of 2 scale (exact) that brings the largest value to [2^14, 2^15)
+        const int exponent = maxValue > 0.0f ? std::ilogb(maxValue) : 0;
+        chunk.reference = std::ldexp(1.0f, std::min(std::max(14 - exponent, -126), 127));
+        for (size_t i=0; i<count; ++i) {
+            const uint16_t half = floatToHalf(m_pending[i] * chunk.reference);
+            memcpy(&m_encoded[i * sizeof(half)], &half, sizeof(half));
+        }
+        payloadSize = count * sizeof(uint16_t);
+    } else {
+        // values (decibels) rounded to the nearest code below the reference
+        chunk.reference = maxValue > 0.0f ? 10.0f * std::log10(maxValue) : 0.0f;
+        const float codesPerDecibel = 1.0f / log8Step(m_info.dynamicRange);
+        for (size_t i=0; i<count; ++i) {
+            const float value = m_pending[i];
+            int code = 0;
+            if (value > 0.0f) {
+                const float belowReference = (chunk.reference - 10.0f * std::log10(value)) * codesPerDecibel;
+                code = belowReference < 254.5f ? 255 - static_cast<int>(std::lround(std::max(belowReference, 0.0f))) : 0;
+            }
+            m_encoded[i] = static_cast<uint8_t>(code);
+        }
+        payloadSize = count;
+    }
+    std::fill(m_encoded.begin() + payloadSize, m_encoded.begin() + padded(payloadSize), 0);
+
+    const SpectrogramIndexEntry entry = {m_offset, m_numFrames};
+    if (!write(&chunk, sizeof(chunk)) || !write(m_encoded.data(), padded(payloadSize))) {
+        return false;
+    }
+    m_index.push_back(entry);
+    m_numFrames += m_numPendingFrames;
+    m_numPendingFrames = 0;
+    return true;
+}
+
+SpectrogramReader::SpectrogramReader(const std::string &path) :
+    m_file(path, MappedFile::Access::Random),
+    m_numFrames(0)
+{
+    const uint8_t *data = m_file.data();
+    const size_t size = m_file.size();
+    SpectrogramHeader header;
+    if (size < sizeof(header)) {
+        OSCILLATORS_THROW(std::invalid_argument("Not a spectrogram file"));
+    }
+    memcpy(&header, data, sizeof(header));
+    if (header.magic != spectrogramMagic || header.version != spectrogramVersion) {
+        OSCILLATORS_THROW(std::invalid_argument("Not a spectrogram file, or unsupported version"));
+    }
+    const size_t n = header.numResonators;
+    if ((header.encoding != static_cast<uint16_t>(SpectrogramEncoding::Float16) &&
+         header.encoding != static_cast<uint16_t>(SpectrogramEncoding::Log8)) ||
+        n == 0 || header.framesPerChunk == 0 || sizeof(header) + tablesSize(n) > size) {
+        OSCILLATORS_THROW(std::invalid_argument("Bad spectrogram header"));
+    }
+
+    m_info.frequencies.resize(n);
+    m_info.alphas.resize(n);
+    m_info.betas.resize(n);
+    const uint8_t *tables = data + sizeof(header);
+    memcpy(m_info.frequencies.data(), tables, n * sizeof(float));
+    memcpy(m_info.alphas.data(), tables + n * sizeof(float), n * sizeof(float));
+    memcpy(m_info.betas.data(), tables + 2 * n * sizeof(float), n * sizeof(float));
+    m_info.sampleRate = header.sampleRate;
+    m_info.hop = header.hop;
+    m_info.encoding = static_cast<SpectrogramEncoding>(header.encoding);
+    m_info.dynamicRange = header.dynamicRange;
+    m_info.framesPerChunk = header.framesPerChunk;
+    m_info.index = header.indexOffset != 0;
+
+    if (header.indexOffset != 0) {
+        if (header.indexOffset > size || header.numChunks > (size - header.indexOffset) / sizeof(SpectrogramIndexEntry)) {
+            OSCILLATORS_THROW(std::invalid_argument("Bad spectrogram index"));
+        }
+        m_chunks.resize(header.numChunks);
+        memcpy(m_chunks.data(), data + header.indexOffset, m_chunks.size() * sizeof(SpectrogramIndexEntry));
+        for (size_t k=1; k<m_chunks.size(); ++k) {
+            if (m_chunks[k].firstFrame <= m_chunks[k-1].firstFrame) {
+                OSCILLATORS_THROW(std::invalid_argument("Bad spectrogram index"));
+            }
+        }
+        // the chunks cover frames [0, numFrames)
+        if (m_chunks.empty() ? header.numFrames != 0 :
+            (m_chunks.front().firstFrame != 0 || m_chunks.back().firstFrame >= header.numFrames)) {
+            OSCILLATORS_THROW(std::invalid_argument("Bad spectrogram index"));
+        }
+        m_numFrames = header.numFrames;
+    } else {
+        // no index (or not closed): the chunk headers are walked, the frames are not read
+        const size_t frameSize = n * valueSize(m_info.encoding);
+        size_t offset = sizeof(header) + tablesSize(n);
+        SpectrogramChunkHeader chunk;
+        while (offset <= size && size - offset >= sizeof(chunk)) {
+            memcpy(&chunk, data + offset, sizeof(chunk));
+            const size_t chunkSize = sizeof(chunk) + padded(chunk.numFrames * frameSize);
+            if (chunk.numFrames == 0 || chunk.numFrames > header.framesPerChunk || chunk.firstFrame != m_numFrames ||
+                chunkSize > size - offset) {
+                break; // end of the chunks, or incomplete chunk
+            }
+            m_chunks.push_back({offset, m_numFrames});
+            m_numFrames += chunk.numFrames;
+            offset += chunkSize;
+        }
+        if (header.numFrames != 0 && header.numFrames != m_numFrames) {
+            OSCILLATORS_THROW(std::invalid_argument("Bad spectrogram chunks"));
+        }
+    }
+}
+
+size_t SpectrogramReader::chunkIndex(size_t frame) const {
+    const auto next = std::upper_bound(m_chunks.begin(), m_chunks.end(), frame,
+                                       [](size_t value, const SpectrogramIndexEntry &entry) { return value < entry.firstFrame; });
+    return static_cast<size_t>(next - m_chunks.begin()) - 1;
+}
+
+void SpectrogramReader::readFrames(size_t first, size_t count, float *frames) const {
+    if (first > m_numFrames || count > m_numFrames - first) {
+        OSCILLATORS_THROW(std::out_of_range("Frames out of range"));
+    }
+    const size_t n = numResonators();
+    const size_t frameSize = n * valueSize(m_info.encoding);
+    const uint8_t *data = m_file.data();
+    size_t k = count > 0 ? chunkIndex(first) : 0;
+    while (count > 0) {
+        const SpectrogramIndexEntry &entry = m_chunks[k++];
+        SpectrogramChunkHeader chunk;
+        if (entry.offset > m_file.size() || m_file.size() - entry.offset < sizeof(chunk)) {
+            OSCILLATORS_THROW(std::invalid_argument("Bad spectrogram chunk"));
+        }
+        memcpy(&chunk, data + entry.offset, sizeof(chunk));
+        if (chunk.firstFrame != entry.firstFrame || chunk.numFrames == 0 ||
+            chunk.numFrames * frameSize > m_file.size() - entry.offset - sizeof(chunk) ||
+            first >= chunk.firstFrame + chunk.numFrames) {
+            OSCILLATORS_THROW(std::invalid_argument("Bad spectrogram chunk"));
+        }
+        const size_t row = first - chunk.firstFrame;
+        const size_t numRows = std::min(count, chunk.numFrames - row);
+        const uint8_t *values = data + entry.offset + sizeof(chunk) + row * frameSize;
+        const size_t numValues = numRows * n;
+        if (m_info.encoding == SpectrogramEncoding::Float16) {
+            for (size_t i=0; i<numValues; ++i) {
+                uint16_t half;
+                memcpy(&half, values + i * sizeof(half), sizeof(half));
+                frames[i] = halfToFloat(half);
+            }
+            vops::scalarMultiply(frames, 1.0f / chunk.reference, frames, numValues);
+        } else {
+            float table[256];
+            decodeLog8Table(chunk.reference, m_info.dynamicRange, table);
+            for (size_t i=0; i<numValues; ++i) {
+                frames[i] = table[values[i]];
+            }
+        }
+        frames += numValues;
+        first += numRows;
+        count -= numRows;
+    }
+}
@@ -0,0 +1,177 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef Spectrogram_hpp
+#define Spectrogram_hpp
+
+#include "MappedFile.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace oscillators_cpp {
+
+/// Spectrogram files: frames of resonator bank outputs (powers or amplitudes, one value per resonator),
+/// stored compactly for archiving and reloaded by random access through a memory mapping.
+///
+/// Layout (native byte order):
+/// - SpectrogramHeader
+/// - frequencies, alphas, betas (numResonators floats each), padded to 8 bytes
+/// - chunks: SpectrogramChunkHeader followed by numFrames rows of encoded values, padded to 8 bytes
+/// - optional index (after the last chunk): one SpectrogramIndexEntry per chunk
+/// The header is rewritten when the writer is closed (number of frames and chunks, index offset). A file that was not
+/// closed (e.g. still being written) has no index, and its complete chunks are found from the chunk headers.
+constexpr uint32_t spectrogramMagic = 0x4753534f; // "OSSG"
+constexpr uint16_t spectrogramVersion = 1;
+
+/// Encoding of the values. In both cases the values of a chunk are relative to a per-chunk reference,
+/// so that quiet passages keep their relative precision.
+enum class SpectrogramEncoding : uint16_t {
+    /// Half precision floats (2 bytes per value), scaled by a power of 2 per chunk: relative error below 2^-11
+    /// down to 2^-28 times the largest value of the chunk
+    Float16 = 1,
+    /// Logarithmic 8-bit codes (1 byte per value) over the dynamic range below the largest value of the chunk:
+    /// 255 levels, 0 for values below the range (decoded as 0)
+    Log8 = 2
+};
+
+struct SpectrogramHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t encoding;
+    uint32_t numResonators;
+    uint32_t hop;
+    float sampleRate;
+    /// Log8 dynamic range in decibels (10 log10 of the ratio of values)
+    float dynamicRange;
+    uint32_t framesPerChunk;
+    uint32_t reserved;
+    /// Set when the file is closed (zero before)
+    uint64_t numFrames;
+    uint64_t numChunks;
+    /// Offset of the index in bytes, zero if none
+    uint64_t indexOffset;
+    uint64_t reserved2;
+};
+
+struct SpectrogramChunkHeader {
+    uint32_t numFrames;
+    /// Float16: scale applied to the values before conversion; Log8: decibels of the code 255
+    float reference;
+    uint64_t firstFrame;
+};
+
+struct SpectrogramIndexEntry {
+    uint64_t offset;
+    uint64_t firstFrame;
+};
+
+struct SpectrogramInfo {
+    std::vector<float> frequencies;
+    std::vector<float> alphas;
+    std::vector<float> betas;
+    float sampleRate = 0.0f;
+    /// Samples between frames
+    size_t hop = 0;
+    SpectrogramEncoding encoding = SpectrogramEncoding::Float16;
+    /// Log8 dynamic range in decibels
+    float dynamicRange = 96.0f;
+    /// Frames per chunk (unit of encoding, and of random access)
+    size_t framesPerChunk = 256;
+    /// Write an index of the chunks when closing
+    bool index = true;
+
+    size_t numResonators() const { return frequencies.size(); }
+};
+
+/// Appends frames to a spectrogram file, e.g. from the update loop of a bank. Frames are buffered and encoded by chunk.
+class SpectrogramWriter {
+public:
+    SpectrogramWriter & operator=(const SpectrogramWriter&) = delete;
+    SpectrogramWriter(const SpectrogramWriter&) = delete;
+
+    /// Create (or truncate) the file at path; frequencies, alphas and betas must have the same size (at least 1)
+    SpectrogramWriter(const std::string &path, const SpectrogramInfo &info);
+    /// Closes the file if close() was not called (errors are then ignored)
+    ~SpectrogramWriter();
+
+    /// Append numFrames rows of numResonators() values
+    void append(const float *frames, size_t numFrames);
+    /// Write the frames buffered so far as a (possibly short) chunk, and flush the file, so that readers opening it
+    /// see all the frames appended
+    void flush();
+    /// Flush, write the index and the final header, and close the file
+    void close();
+
+    size_t numFrames() const { return m_numFrames + m_numPendingFrames; }
+
+private:
+    /// Write the pending frames as a chunk (false on failure)
+    bool writeChunk();
+    bool write(const void *data, size_t size);
+    /// Write the last chunk, the index and the final header, and close the file (false on failure)
+    bool finish();
+
+    FILE *m_file;
+    std::string m_path;
+    SpectrogramInfo m_info;
+    SpectrogramHeader m_header;
+    /// Frames of the current chunk, not yet written
+    std::vector<float> m_pending;
+    size_t m_numPendingFrames;
+    std::vector<uint8_t> m_encoded;
+    std::vector<SpectrogramIndexEntry> m_index;
+    uint64_t m_offset;
+    uint64_t m_numFrames;
+};
+
+/// Random access to the frames of a spectrogram file, memory-mapped: only the chunks read are loaded.
+class SpectrogramReader {
+public:
+    explicit SpectrogramReader(const std::string &path);
+
+    const SpectrogramInfo &info() const { return m_info; }
+    size_t numResonators() const { return m_info.numResonators(); }
+    size_t numFrames() const { return m_numFrames; }
+    size_t numChunks() const { return m_chunks.size(); }
+
+    /// Decode frames [first, first + count) into rows of numResonators() values
+    void readFrames(size_t first, size_t count, float *frames) const;
+
+private:
+    /// Index of the chunk containing frame
+    size_t chunkIndex(size_t frame) const;
+
+    MappedFile m_file;
+    SpectrogramInfo m_info;
+    size_t m_numFrames;
+    std::vector<SpectrogramIndexEntry> m_chunks;
+};
+
+} // oscillators_cpp
+
+#endif /* Spectrogram_hpp */
@@ -0,0 +1,92 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#import "SpectrogramReaderCpp.h"
+
+#import <Foundation/Foundation.h>
+
+#include "Spectrogram.hpp"
+
+#include <algorithm>
+
+using namespace oscillators_cpp;
+
+@interface SpectrogramReaderCpp()
+@property oscillators_cpp::SpectrogramReader *spectrogramReader;
+@end
+
+@implementation SpectrogramReaderCpp
+
+- (instancetype)initWithPath:(NSString*)path {
+    if (self = [super init]) {
+        self.spectrogramReader = new SpectrogramReader([path UTF8String]);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    delete self.spectrogramReader;
+}
+
+- (int)numResonators {
+    return static_cast<int>(self.spectrogramReader->numResonators());
+}
+
+- (int)numFrames {
+    return static_cast<int>(self.spectrogramReader->numFrames());
+}
+
+- (int)numChunks {
+    return static_cast<int>(self.spectrogramReader->numChunks());
+}
+
+- (float)sampleRate {
+    return self.spectrogramReader->info().sampleRate;
+}
+
+- (int)hop {
+    return static_cast<int>(self.spectrogramReader->info().hop);
+}
+
+- (void)getFrequencies:(float*)dest size:(int)size {
+    const std::vector<float> &frequencies = self.spectrogramReader->info().frequencies;
+    std::copy(frequencies.begin(), frequencies.begin() + std::min(static_cast<size_t>(size), frequencies.size()), dest);
+}
+
+- (void)getAlphas:(float*)dest size:(int)size {
+    const std::vector<float> &alphas = self.spectrogramReader->info().alphas;
+    std::copy(alphas.begin(), alphas.begin() + std::min(static_cast<size_t>(size), alphas.size()), dest);
+}
+
+- (void)getBetas:(float*)dest size:(int)size {
+    const std::vector<float> &betas = self.spectrogramReader->info().betas;
+    std::copy(betas.begin(), betas.begin() + std::min(static_cast<size_t>(size), betas.size()), dest);
+}
+
+- (void)readFrames:(float*)dest first:(int)first count:(int)count {
+    self.spectrogramReader->readFrames(first, count, dest);
+}
+
+@end
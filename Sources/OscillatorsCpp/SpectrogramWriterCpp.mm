@@ -0,0 +1,93 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#import "SpectrogramWriterCpp.h"
+
+#import <Foundation/Foundation.h>
+
+#include "Spectrogram.hpp"
+
+using namespace oscillators_cpp;
+
+@interface SpectrogramWriterCpp()
+@property oscillators_cpp::SpectrogramWriter *spectrogramWriter;
+@end
+
+namespace {
+
+SpectrogramInfo spectrogramInfo(int numResonators, const float *frequencies, const float *alphas, const float *betas, float sampleRate, int hop, int framesPerChunk) {
+    SpectrogramInfo info;
+    info.frequencies.assign(frequencies, frequencies + numResonators);
+    info.alphas.assign(alphas, alphas + numResonators);
+    info.betas.assign(betas, betas + numResonators);
+    info.sampleRate = sampleRate;
+    info.hop = hop;
+    info.framesPerChunk = framesPerChunk;
+    return info;
+}
+
+} // namespace
+
+@implementation SpectrogramWriterCpp
+
+- (instancetype)initWithPath:(NSString*)path numResonators:(int)numResonators frequencies:(const float*)frequencies alphas:(const float*)alphas betas:(const float*)betas sampleRate:(float)sampleRate hop:(int)hop framesPerChunk:(int)framesPerChunk {
+    if (self = [super init]) {
+        SpectrogramInfo info = spectrogramInfo(numResonators, frequencies, alphas, betas, sampleRate, hop, framesPerChunk);
+        self.spectrogramWriter = new SpectrogramWriter([path UTF8String], info);
+    }
+    return self;
+}
+
+- (instancetype)initLog8WithPath:(NSString*)path numResonators:(int)numResonators frequencies:(const float*)frequencies alphas:(const float*)alphas betas:(const float*)betas sampleRate:(float)sampleRate hop:(int)hop framesPerChunk:(int)framesPerChunk dynamicRange:(float)dynamicRange {
+    if (self = [super init]) {
+        SpectrogramInfo info = spectrogramInfo(numResonators, frequencies, alphas, betas, sampleRate, hop, framesPerChunk);
+        info.encoding = SpectrogramEncoding::Log8;
+        info.dynamicRange = dynamicRange;
+        self.spectrogramWriter = new SpectrogramWriter([path UTF8String], info);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    delete self.spectrogramWriter;
+}
+
+- (void)append:(const float*)frames numFrames:(int)numFrames {
+    self.spectrogramWriter->append(frames, numFrames);
+}
+
+- (void)flush {
+    self.spectrogramWriter->flush();
+}
+
+- (void)close {
+    self.spectrogramWriter->close();
+}
+
+- (int)numFrames {
+    return static_cast<int>(self.spectrogramWriter->numFrames());
+}
+
+@end
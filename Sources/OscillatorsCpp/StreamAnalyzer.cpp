@@ -0,0 +1,101 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "StreamAnalyzer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+using namespace oscillators_cpp;
+
+/// Bounds of the analysis thread's sleep time when less than a hop is queued, in microseconds
+constexpr int64_t minPollInterval = 50;
+constexpr int64_t maxPollInterval = 10000;
+
+StreamAnalyzer::StreamAnalyzer(ResonatorBankVec &bank, size_t hopSize, size_t capacity, HopCallback callback, void *context)
+: m_bank(bank), m_hopSize(hopSize), m_ringBuffer(std::max(capacity, 2 * std::max(hopSize, size_t(1)))),
+m_callback(callback), m_context(context), m_stop(false), m_overruns(0), m_droppedSamples(0), m_hopsProcessed(0) {
+    if (hopSize == 0) {
+        throw std::invalid_argument("Bad hopSize passed to StreamAnalyzer()");
+    }
+    m_hop.resize(m_hopSize);
+    m_powers.resize(m_bank.numResonators());
+    // poll 4 times per hop duration
+    const double hopDuration = 1e6 * static_cast<double>(m_hopSize) / m_bank.sampleRate();
+    m_pollInterval = std::min(maxPollInterval, std::max(minPollInterval, static_cast<int64_t>(hopDuration / 4.0)));
+}
+
+StreamAnalyzer::~StreamAnalyzer() {
+    stop();
+}
+
+void StreamAnalyzer::start() {
+    if (m_thread.joinable()) {
+        return;
+    }
+    m_stop.store(false, std::memory_order_relaxed);
+    m_thread = std::thread(&StreamAnalyzer::analysisLoop, this);
+}
+
+void StreamAnalyzer::stop() {
+    if (!m_thread.joinable()) {
+        return;
+    }
+    m_stop.store(true, std::memory_order_relaxed);
+    m_thread.join();
+}
+
+size_t StreamAnalyzer::push(const float *frameData, size_t frameLength, size_t sampleStride) {
+    const size_t numSamples = (frameLength + sampleStride - 1) / sampleStride;
+    const size_t written = m_ringBuffer.write(frameData, frameLength, sampleStride);
+    if (written < numSamples) {
+        m_overruns.fetch_add(1, std::memory_order_relaxed);
+        m_droppedSamples.fetch_add(numSamples - written, std::memory_order_relaxed);
+    }
+    return written;
+}
+
+void StreamAnalyzer::analysisLoop() {
+    const size_t numResonators = m_bank.numResonators();
+    while (!m_stop.load(std::memory_order_relaxed)) {
+        if (m_ringBuffer.size() < m_hopSize) {
+            std::this_thread::sleep_for(std::chrono::microseconds(m_pollInterval));
+            continue;
+        }
+        m_ringBuffer.read(m_hop.data(), m_hopSize);
+        if (m_bank.numThreads() > 1) {
+            m_bank.updateConcurrent(m_hop.data(), m_hopSize, 1, m_callback ? m_powers.data() : nullptr);
+        } else {
+            m_bank.update(m_hop.data(), m_hopSize, 1);
+            if (m_callback) {
+                m_bank.getPowers(m_powers.data(), numResonators);
+            }
+        }
+        if (m_callback) {
+            m_callback(m_context, m_powers.data(), numResonators);
+        }
+        m_hopsProcessed.fetch_add(1, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,103 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef StreamAnalyzer_hpp
+#define StreamAnalyzer_hpp
+
+#include "ResonatorBankVec.hpp"
+#include "RingBuffer.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace oscillators_cpp {
+
+/// Streaming front end for a ResonatorBankVec, for real-time use.
+/// The audio thread pushes frames into a wait-free SPSC ring buffer (no locks, no allocation, no system calls),
+/// and a dedicated analysis thread drains it in hops of hopSize samples and runs the bank on each hop
+/// (concurrently if the bank has more than 1 thread), so that the bank's throughput is decoupled
+/// from the callback deadlines. When the buffer is full, the samples that do not fit are dropped and
+/// counted as an overrun.
+/// The bank must not be used by other threads between start() and stop().
+class StreamAnalyzer {
+public:
+    /// Called on the analysis thread after each hop, with the powers of the bank (numResonators values)
+    typedef void (*HopCallback)(void *context, const float *powers, size_t numResonators);
+
+    StreamAnalyzer & operator=(const StreamAnalyzer&) = delete;
+    StreamAnalyzer(const StreamAnalyzer&) = delete;
+
+    /// capacity is the size of the ring buffer, in samples (rounded up to a power of 2, at least 2 hops)
+    StreamAnalyzer(ResonatorBankVec &bank, size_t hopSize, size_t capacity, HopCallback callback = nullptr, void *context = nullptr);
+    ~StreamAnalyzer();
+
+    size_t hopSize() const { return m_hopSize; }
+    size_t capacity() const { return m_ringBuffer.capacity(); }
+
+    /// Start and stop the analysis thread (samples left in the buffer when stopping stay there)
+    void start();
+    void stop();
+    bool running() const { return m_thread.joinable(); }
+
+    /// Audio thread (wait-free): queue the samples of a frame (every sampleStride values of frameData);
+    /// returns the number of samples queued (less than the frame on overrun)
+    size_t push(const float *frameData, size_t frameLength, size_t sampleStride);
+
+    /// Number of samples waiting in the buffer
+    size_t queueDepth() const { return m_ringBuffer.size(); }
+    /// Number of pushes that could not queue all their samples, and total number of samples dropped
+    uint64_t overruns() const { return m_overruns.load(std::memory_order_relaxed); }
+    uint64_t droppedSamples() const { return m_droppedSamples.load(std::memory_order_relaxed); }
+    /// Number of hops processed by the analysis thread
+    uint64_t hopsProcessed() const { return m_hopsProcessed.load(std::memory_order_relaxed); }
+
+private:
+    ResonatorBankVec &m_bank;
+    size_t m_hopSize;
+    RingBuffer m_ringBuffer;
+    HopCallback m_callback;
+    void *m_context;
+
+    /// Analysis thread: hop samples and powers (intermediate calculations)
+    std::vector<float> m_hop;
+    std::vector<float> m_powers;
+    /// Analysis thread: sleep time when less than a hop is queued, in microseconds
+    int64_t m_pollInterval;
+
+    std::thread m_thread;
+    std::atomic<bool> m_stop;
+
+    std::atomic<uint64_t> m_overruns;
+    std::atomic<uint64_t> m_droppedSamples;
+    std::atomic<uint64_t> m_hopsProcessed;
+
+    void analysisLoop();
+};
+
+} // oscillators_cpp
+
+#endif /* StreamAnalyzer_hpp */
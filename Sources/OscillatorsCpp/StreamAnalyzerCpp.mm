@@ -0,0 +1,106 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#import "StreamAnalyzerCpp.h"
+
+#import <Foundation/Foundation.h>
+
+#include "StreamAnalyzer.hpp"
+
+using namespace oscillators_cpp;
+
+@interface StreamAnalyzerCpp()
+@property oscillators_cpp::ResonatorBankVec *resonatorBank;
+@property oscillators_cpp::StreamAnalyzer *streamAnalyzer;
+@end
+
+@implementation StreamAnalyzerCpp
+
+- (instancetype)initWithNumResonators:(int)numResonators frequencies:(const float*)frequencies alphas:(const float*)alphas betas:(const float*)betas sampleRate:(float)sampleRate hopSize:(int)hopSize capacity:(int)capacity {
+    if (self = [super init]) {
+        self.resonatorBank = new ResonatorBankVec(numResonators, frequencies, alphas, betas, sampleRate);
+        self.resonatorBank->setSnapshotsEnabled(true);
+        self.streamAnalyzer = new StreamAnalyzer(*self.resonatorBank, hopSize, capacity);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    delete self.streamAnalyzer;
+    delete self.resonatorBank;
+}
+
+- (int)numResonators {
+    return static_cast<int>(self.resonatorBank->numResonators());
+}
+
+- (int)hopSize {
+    return static_cast<int>(self.streamAnalyzer->hopSize());
+}
+
+- (int)capacity {
+    return static_cast<int>(self.streamAnalyzer->capacity());
+}
+
+- (void)start {
+    self.streamAnalyzer->start();
+}
+
+- (void)stop {
+    self.streamAnalyzer->stop();
+}
+
+- (bool)running {
+    return self.streamAnalyzer->running();
+}
+
+- (int)push:(float*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride {
+    return static_cast<int>(self.streamAnalyzer->push(frame, frameLength, sampleStride));
+}
+
+- (int)queueDepth {
+    return static_cast<int>(self.streamAnalyzer->queueDepth());
+}
+
+- (int)overruns {
+    return static_cast<int>(self.streamAnalyzer->overruns());
+}
+
+- (int)droppedSamples {
+    return static_cast<int>(self.streamAnalyzer->droppedSamples());
+}
+
+- (int)hopsProcessed {
+    return static_cast<int>(self.streamAnalyzer->hopsProcessed());
+}
+
+- (void)getPowers:(float*)dest size:(int)size {
+    self.resonatorBank->getPowers(dest, size);
+}
+
+- (int)getSnapshotPowers:(float*)powers amplitudes:(float*)amplitudes phases:(float*)phases size:(int)size {
+    return static_cast<int>(self.resonatorBank->getSnapshot(powers, amplitudes, phases, size));
+}
+
+@end
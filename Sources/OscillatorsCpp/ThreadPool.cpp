@@ -0,0 +1,151 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+using namespace oscillators_cpp;
+
+/// Number of polls of the generation counter before an idle worker blocks;
+/// the worker yields every few polls, so that spinning does not starve other threads when the CPUs are oversubscribed
+constexpr int spinCount = 2048;
+constexpr int spinYieldInterval = 64;
+
+static inline void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+void oscillators_cpp::pinToCPU(std::thread &thread, size_t cpu) {
+#if defined(__linux__)
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(cpu % CPU_SETSIZE, &cpuSet);
+    pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpuSet);
+#else
+    (void)thread;
+    (void)cpu;
+#endif
+}
+
+ThreadPool::ThreadPool(size_t numThreads, bool pinThreads)
+: m_generation(0), m_pendingWorkers(0), m_stop(false), m_numTasks(0), m_function(nullptr), m_context(nullptr) {
+    const size_t numCPUs = std::max(1u, std::thread::hardware_concurrency());
+    if (numThreads == 0) {
+        numThreads = numCPUs;
+    }
+    m_workers.reserve(numThreads - 1);
+    for (size_t i=1; i<numThreads; ++i) {
+        m_workers.emplace_back(&ThreadPool::workerLoop, this, i);
+        if (pinThreads) {
+            pinToCPU(m_workers.back(), i % numCPUs);
+        }
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop.store(true, std::memory_order_relaxed);
+        m_generation.fetch_add(1, std::memory_order_release);
+    }
+    m_wakeUp.notify_all();
+    for (auto &worker : m_workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::run(size_t numTasks, TaskFunction function, void *context) {
+    if (m_workers.empty() || numTasks <= 1) {
+        for (size_t i=0; i<numTasks; ++i) {
+            function(context, i);
+        }
+        return;
+    }
+
+    m_numTasks = numTasks;
+    m_function = function;
+    m_context = context;
+    m_pendingWorkers.store(m_workers.size(), std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_generation.fetch_add(1, std::memory_order_release);
+    }
+    m_wakeUp.notify_all();
+
+    runTasks(0);
+
+    // the workers are expected to finish at about the same time as the calling thread
+    while (m_pendingWorkers.load(std::memory_order_acquire) != 0) {
+        std::this_thread::yield();
+    }
+}
+
+void ThreadPool::runTasks(size_t threadIndex) {
+    const size_t stride = numThreads();
+    for (size_t i=threadIndex; i<m_numTasks; i += stride) {
+        m_function(m_context, i);
+    }
+}
+
+void ThreadPool::workerLoop(size_t threadIndex) {
+    uint64_t seen = 0;
+    for (;;) {
+        uint64_t generation = m_generation.load(std::memory_order_acquire);
+        for (int spin=1; generation == seen && spin <= spinCount; ++spin) {
+            if (spin % spinYieldInterval == 0) {
+                std::this_thread::yield();
+            } else {
+                cpuRelax();
+            }
+            generation = m_generation.load(std::memory_order_acquire);
+        }
+        if (generation == seen) {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wakeUp.wait(lock, [&] { return m_generation.load(std::memory_order_acquire) != seen; });
+            generation = m_generation.load(std::memory_order_acquire);
+        }
+        seen = generation;
+
+        if (m_stop.load(std::memory_order_relaxed)) {
+            return;
+        }
+
+        runTasks(threadIndex);
+        m_pendingWorkers.fetch_sub(1, std::memory_order_acq_rel);
+    }
+}
@@ -0,0 +1,96 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef ThreadPool_hpp
+#define ThreadPool_hpp
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace oscillators_cpp {
+
+/// Set the affinity of a thread to a CPU (Linux only, ignored elsewhere)
+void pinToCPU(std::thread &thread, size_t cpu);
+
+/// Persistent pool of worker threads for fork-join parallel loops over a fixed number of tasks.
+/// The calling thread participates as thread 0, and task i always runs on thread i % numThreads,
+/// so that a given task's data stays in the same core's cache from one call to the next.
+/// Idle workers spin briefly on the next call before blocking, which keeps the hand-off latency low
+/// when calls follow each other closely (e.g. one call per audio frame).
+/// Calls to run() must not overlap, and tasks must not throw.
+class ThreadPool {
+public:
+    typedef void (*TaskFunction)(void *context, size_t taskIndex);
+
+    ThreadPool & operator=(const ThreadPool&) = delete;
+    ThreadPool(const ThreadPool&) = delete;
+
+    /// numThreads includes the calling thread, 0 for the number of hardware threads.
+    /// pinThreads sets the affinity of worker i to CPU i (Linux only, ignored elsewhere).
+    ThreadPool(size_t numThreads = 0, bool pinThreads = false);
+    ~ThreadPool();
+
+    size_t numThreads() const { return m_workers.size() + 1; }
+
+    /// Call function(context, i) for i in [0, numTasks), return when all the tasks are done
+    void run(size_t numTasks, TaskFunction function, void *context);
+
+    /// Call task(i) for i in [0, numTasks), return when all the tasks are done
+    template <typename F>
+    void run(size_t numTasks, F &&task) {
+        typedef typename std::remove_reference<F>::type Task;
+        run(numTasks,
+            [](void *context, size_t taskIndex) { (*static_cast<Task *>(context))(taskIndex); },
+            const_cast<void *>(static_cast<const void *>(std::addressof(task))));
+    }
+
+private:
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_mutex;
+    std::condition_variable m_wakeUp;
+    /// Incremented (under m_mutex) for each call to run()
+    std::atomic<uint64_t> m_generation;
+    /// Number of workers that have not finished their tasks for the current generation
+    std::atomic<size_t> m_pendingWorkers;
+    std::atomic<bool> m_stop;
+
+    size_t m_numTasks;
+    TaskFunction m_function;
+    void *m_context;
+
+    void runTasks(size_t threadIndex);
+    void workerLoop(size_t threadIndex);
+};
+
+} // oscillators_cpp
+
+#endif /* ThreadPool_hpp */
@@ -0,0 +1,378 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef VectorOps_hpp
+#define VectorOps_hpp
+
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+
+// use Accelerate (vDSP/vForce) on Apple platforms by default
+// define OSCILLATORS_PORTABLE_VECTOR_OPS to use the portable implementation instead
+#if defined(__APPLE__) && !defined(OSCILLATORS_PORTABLE_VECTOR_OPS)
+#define OSCILLATORS_USE_ACCELERATE
+#endif
+
+#ifdef OSCILLATORS_USE_ACCELERATE
+#include <Accelerate/Accelerate.h>
+#endif
+
+// The portable loops are written for compiler auto-vectorization (-O2/-O3).
+// Outputs may alias inputs exactly (in-place operation), but must not partially overlap.
+#if defined(__clang__)
+#define OSCILLATORS_VECTORIZE _Pragma("clang loop vectorize(enable) interleave(enable)")
+#elif defined(__GNUC__)
+#define OSCILLATORS_VECTORIZE _Pragma("GCC ivdep")
+#else
+#define OSCILLATORS_VECTORIZE
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define OSCILLATORS_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define OSCILLATORS_ALWAYS_INLINE inline
+#endif
+
+// Errors are reported with exceptions; when compiled with exceptions disabled (-fno-exceptions), they abort instead
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS)
+#define OSCILLATORS_THROW(exception) throw exception
+#else
+#define OSCILLATORS_THROW(exception) std::abort()
+#endif
+
+namespace oscillators_cpp {
+
+/// Vector operations backend: the subset of vDSP/vForce used by the vectorized classes.
+/// Complex vectors are in split (non-interlaced) format: real parts and imaginary parts in separate arrays.
+/// The operations used by ResonatorBankVecT<double> also have double overloads (the vDSP ...D and vForce double functions).
+namespace vops {
+
+/// dest[i] = value
+inline void fill(float value, float *dest, size_t count) {
+#ifdef OSCILLATORS_USE_ACCELERATE
+    vDSP_vfill(&value, dest, 1, count);
+#else
+    OSCILLATORS_VECTORIZE
+    for (size_t i=0; i<count; ++i) {
+        dest[i] = value;
+    }
+#endif
+}
+
+inline void fill(double value, double *dest, size_t count) {
+#ifdef OSCILLATORS_USE_ACCELERATE
+    vDSP_vfillD(&value, dest, 1, count);
+#else
+    OSCILLATORS_VECTORIZE
+    for (size_t i=0; i<count; ++i) {
+        dest[i] = value;
+    }
+#endif
+}
+
+/// dest[i] = a[i] * b  (vDSP_vsmul)
+inline void scalarMultiply(const float *a, float b, float *dest, size_t count) {
+#ifdef OSCILLATORS_USE_ACCELERATE
+    vDSP_vsmul(a, 1, &b, dest, 1, count);
+#else
+    OSCILLATORS_VECTORIZE
+    for (size_t i=0; i<count; ++i) {
+        dest[i] = a[i] * b;
+    }
+#endif
+}
+
+inline void scalarMultiply(const double *a, double b, double *dest, size_t count) {
+#ifdef OSCILLATORS_USE_ACCELERATE
+    vDSP_vsmulD(a, 1, &b, dest, 1, count);
+#else
+    OSCILLATORS_VECTORIZE
+    for (size_t i=0; i<count; ++i) {
+        dest[i] = a[i] * b;
+    }
+#endif
+}
+
+/// dest[i] = a[i] * b + c  (vDSP_vsmsa)
+inline void scalarMultiplyScalarAdd(const float *a, float b, float c, float *dest, size_t count) {
+#ifdef OSCILLATORS_USE_ACCELERATE
+    vDSP_vsmsa(a, 1, &b, &c, dest, 1, count);
+#else
+    OSCILLATORS_VECTORIZE
+    for (size_t i=0; i<count; ++i) {
+        dest[i] = a[i] * b + c;
+    }
+#endif
+}
+
+inline void scalarMultiplyScalarAdd(const double *a, double b, double c, double *dest, size_t count) {
+#ifdef OSCILLATORS_USE_ACCELERATE
+    vDSP_vsmsaD(a, 1, &b, &c, dest, 1, count);
+#else
+    OSCILLATORS_VECTORIZE
+    for (size_t i=0; i<count; ++i) {
+        dest[i] = a[i] * b + c;
+    }
+#endif
+}
+
+/// dest = a * b, with a split complex and b real  (vDSP_zrvmul)
+inline void complexRealMultiply(const float *aReal, const float *aImag, const float *b, float *destReal, float *destImag, size_t count) {
+#ifdef OSCILLATORS_USE_ACCELERATE
+    DSPSplitComplex A = {const_cast<float*>(aReal), const_cast<float*>(aImag)};
+    DSPSplitComplex D = {destReal, destImag};
+    vDSP_zrvmul(&A, 1, b, 1, &D, 1, count);
+#else
+    OSCILLATORS_VECTORIZE
+    for (size_t i=0; i<count; ++i) {
+        destReal[i] = aReal[i] * b[i];
+        destImag[i] = aImag[i] * b[i];
+    }
+#endif
+}
+
+inline void complexRealMultiply(const double *aReal, const double *aImag, const double *b, double *destReal, double *destImag, size_t count) {
+#ifdef OSCILLATORS_USE_ACCELERATE
+    DSPDoubleSplitComplex A = {const_cast<double*>(aReal), const_cast<double*>(aImag)};
+    DSPDoubleSplitComplex D = {destReal, destImag};
+    vDSP_zrvmulD(&A, 1, b, 1, &D, 1, count);
+#else
+    OSCILLATORS_VECTORIZE
+    for (size_t i=0; i<count; ++i) {
+        destReal[i] = aReal[i] * b[i];
+        destImag[i] = aImag[i] * b[i];
+    }
+#endif
+}
+
+/// dest[i] = |a[i]|^2, split complex  (vDSP_zvmags)
+inline void squaredMagnitudes(const float *aReal, const float *aImag, float *dest, size_t count) {
+#ifdef OSCILLATORS_USE_ACCELERATE
+    DSPSplitComplex A = {const_cast<float*>(aReal), const_cast<float*>(aImag)};
+    vDSP_zvmags(&A, 1, dest, 1, count);
+#else
+    OSCILLATORS_VECTORIZE
+    for (size_t i=0; i<count; ++i) {
+        dest[i] = aReal[i] * aReal[i] + aImag[i] * aImag[i];
+    }
+#endif
+}
+
+inline void squaredMagnitudes(const double *aReal, const double *aImag, double *dest, size_t count) {
+#ifdef OSCILLATORS_USE_ACCELERATE
+    DSPDoubleSplitComplex A = {const_cast<double*>(aReal), const_cast<double*>(aImag)};
+    vDSP_zvmagsD(&A, 1, dest, 1, count);
+#else
+    OSCILLATORS_VECTORIZE
+    for (size_t i=0; i<count; ++i) {
+        dest[i] = aReal[i] * aReal[i] + aImag[i] * aImag[i];
+    }
+#endif
+}
+
+/// c = a * b, row-major matrices: c is m x n, a is m x k, b is k x n
+/// Portable loops, force-inlined so that they can be compiled for specific instruction sets (see ResonatorBankVecKernels.cpp).
+template <typename Real>
+OSCILLATORS_ALWAYS_INLINE void matrixMultiplyLoops(const Real *a, size_t lda, const Real *b, size_t ldb, Real *c, size_t ldc,
+                                                   size_t m, size_t n, size_t k) {
+    // column tiles of b stay in cache while all the rows of a are processed,
+    // and each row of a tile of b is applied to 4 rows of c at once
+    constexpr size_t tile = 256;
+    for (size_t j0=0; j0<n; j0 += tile) {
+        const size_t width = j0 + tile < n ? tile : n - j0;
+        size_t i = 0;
+        for (; i+4<=m; i += 4) {
+            Real *c0 = c + i * ldc + j0;
+            Real *c1 = c0 + ldc;
+            Real *c2 = c1 + ldc;
+            Real *c3 = c2 + ldc;
+            Real acc0[tile] = {}, acc1[tile] = {}, acc2[tile] = {}, acc3[tile] = {};
+            for (size_t p=0; p<k; ++p) {
+                const Real a0 = a[i * lda + p];
+                const Real a1 = a[(i + 1) * lda + p];
+                const Real a2 = a[(i + 2) * lda + p];
+                const Real a3 = a[(i + 3) * lda + p];
+                const Real *bRow = b + p * ldb + j0;
+                OSCILLATORS_VECTORIZE
+                for (size_t j=0; j<width; ++j) {
+                    acc0[j] += a0 * bRow[j];
+                    acc1[j] += a1 * bRow[j];
+                    acc2[j] += a2 * bRow[j];
+                    acc3[j] += a3 * bRow[j];
+                }
+            }
+            for (size_t j=0; j<width; ++j) {
+                c0[j] = acc0[j];
+                c1[j] = acc1[j];
+                c2[j] = acc2[j];
+                c3[j] = acc3[j];
+            }
+        }
+        for (; i<m; ++i) {
+            Real *c0 = c + i * ldc + j0;
+            Real acc0[tile] = {};
+            for (size_t p=0; p<k; ++p) {
+                const Real a0 = a[i * lda + p];
+                const Real *bRow = b + p * ldb + j0;
+                OSCILLATORS_VECTORIZE
+                for (size_t j=0; j<width; ++j) {
+                    acc0[j] += a0 * bRow[j];
+                }
+            }
+            for (size_t j=0; j<width; ++j) {
+                c0[j] = acc0[j];
+            }
+        }
+    }
+}
+
+/// c = a * b, row-major matrices: c is m x n, a is m x k, b is k x n  (cblas_sgemm)
+/// lda, ldb, ldc are the row strides of a, b and c.
+inline void matrixMultiply(const float *a, size_t lda, const float *b, size_t ldb, float *c, size_t ldc,
+                           size_t m, size_t n, size_t k) {
+#ifdef OSCILLATORS_USE_ACCELERATE
+    cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans,
+                static_cast<int>(m), static_cast<int>(n), static_cast<int>(k),
+                1.0f, a, static_cast<int>(lda), b, static_cast<int>(ldb),
+                0.0f, c, static_cast<int>(ldc));
+#else
+    matrixMultiplyLoops(a, lda, b, ldb, c, ldc, m, n, k);
+#endif
+}
+
+/// (cblas_dgemm)
+inline void matrixMultiply(const double *a, size_t lda, const double *b, size_t ldb, double *c, size_t ldc,
+                           size_t m, size_t n, size_t k) {
+#ifdef OSCILLATORS_USE_ACCELERATE
+    cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans,
+                static_cast<int>(m), static_cast<int>(n), static_cast<int>(k),
+                1.0, a, static_cast<int>(lda), b, static_cast<int>(ldb),
+                0.0, c, static_cast<int>(ldc));
+#else
+    matrixMultiplyLoops(a, lda, b, ldb, c, ldc, m, n, k);
+#endif
+}
+
+/// dest[i] = sqrt(a[i])  (vvsqrtf)
+inline void sqrt(const float *a, float *dest, size_t count) {
+#ifdef OSCILLATORS_USE_ACCELERATE
+    int n = static_cast<int>(count);
+    vvsqrtf(dest, a, &n);
+#else
+    OSCILLATORS_VECTORIZE
+    for (size_t i=0; i<count; ++i) {
+        dest[i] = std::sqrt(a[i]);
+    }
+#endif
+}
+
+inline void sqrt(const double *a, double *dest, size_t count) {
+#ifdef OSCILLATORS_USE_ACCELERATE
+    int n = static_cast<int>(count);
+    vvsqrt(dest, a, &n);
+#else
+    OSCILLATORS_VECTORIZE
+    for (size_t i=0; i<count; ++i) {
+        dest[i] = std::sqrt(a[i]);
+    }
+#endif
+}
+
+/// dest[i] = 1 / sqrt(a[i])  (vvrsqrtf)
+inline void rsqrt(const float *a, float *dest, size_t count) {
+#ifdef OSCILLATORS_USE_ACCELERATE
+    int n = static_cast<int>(count);
+    vvrsqrtf(dest, a, &n);
+#else
+    OSCILLATORS_VECTORIZE
+    for (size_t i=0; i<count; ++i) {
+        dest[i] = 1.0f / std::sqrt(a[i]);
+    }
+#endif
+}
+
+inline void rsqrt(const double *a, double *dest, size_t count) {
+#ifdef OSCILLATORS_USE_ACCELERATE
+    int n = static_cast<int>(count);
+    vvrsqrt(dest, a, &n);
+#else
+    OSCILLATORS_VECTORIZE
+    for (size_t i=0; i<count; ++i) {
+        dest[i] = 1.0 / std::sqrt(a[i]);
+    }
+#endif
+}
+
+/// dest[i] = cos(a[i])  (vvcosf)
+inline void cos(const float *a, float *dest, size_t count) {
+#ifdef OSCILLATORS_USE_ACCELERATE
+    int n = static_cast<int>(count);
+    vvcosf(dest, a, &n);
+#else
+    for (size_t i=0; i<count; ++i) {
+        dest[i] = std::cos(a[i]);
+    }
+#endif
+}
+
+inline void cos(const double *a, double *dest, size_t count) {
+#ifdef OSCILLATORS_USE_ACCELERATE
+    int n = static_cast<int>(count);
+    vvcos(dest, a, &n);
+#else
+    for (size_t i=0; i<count; ++i) {
+        dest[i] = std::cos(a[i]);
+    }
+#endif
+}
+
+/// dest[i] = sin(a[i])  (vvsinf)
+inline void sin(const float *a, float *dest, size_t count) {
+#ifdef OSCILLATORS_USE_ACCELERATE
+    int n = static_cast<int>(count);
+    vvsinf(dest, a, &n);
+#else
+    for (size_t i=0; i<count; ++i) {
+        dest[i] = std::sin(a[i]);
+    }
+#endif
+}
+
+inline void sin(const double *a, double *dest, size_t count) {
+#ifdef OSCILLATORS_USE_ACCELERATE
+    int n = static_cast<int>(count);
+    vvsin(dest, a, &n);
+#else
+    for (size_t i=0; i<count; ++i) {
+        dest[i] = std::sin(a[i]);
+    }
+#endif
+}
+
+} // vops
+
+} // oscillators_cpp
+
+#endif /* VectorOps_hpp */
@@ -0,0 +1,111 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "Wav.hpp"
+#include "VectorOps.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+using namespace oscillators_cpp;
+
+namespace {
+
+constexpr uint16_t wavFormatPCM = 1;
+constexpr uint16_t wavFormatFloat = 3;
+constexpr uint16_t wavFormatExtensible = 0xfffe;
+/// Chunk sizes that do not fit in 32 bits are in the ds64 chunk of RF64 files
+constexpr uint32_t rf64Size = 0xffffffff;
+
+template <typename T>
+T readLE(const uint8_t *bytes) {
+    T value = 0;
+    for (size_t i=0; i<sizeof(T); ++i) {
+        value |= static_cast<T>(bytes[i]) << (8 * i);
+    }
+    return value;
+}
+
+bool isId(const uint8_t *bytes, const char *id) {
+    return memcmp(bytes, id, 4) == 0;
+}
+
+} // namespace
+
+WavInfo oscillators_cpp::parseWav(const void *data, size_t size) {
+    const uint8_t *bytes = static_cast<const uint8_t*>(data);
+    if (size < 12 || !(isId(bytes, "RIFF") || isId(bytes, "RF64")) || !isId(bytes + 8, "WAVE")) {
+        OSCILLATORS_THROW(std::invalid_argument("Not a WAV file"));
+    }
+    WavInfo info = {};
+    bool hasFormat = false;
+    uint64_t rf64DataSize = 0;
+    size_t offset = 12;
+    while (offset + 8 <= size) {
+        const uint8_t *chunk = bytes + offset;
+        const uint32_t chunkSize = readLE<uint32_t>(chunk + 4);
+        const uint8_t *body = chunk + 8;
+        const size_t available = size - offset - 8;
+        if (isId(chunk, "ds64") && available >= 24) {
+            rf64DataSize = readLE<uint64_t>(body + 8);
+        } else if (isId(chunk, "fmt ") && available >= 16) {
+            uint16_t format = readLE<uint16_t>(body);
+            info.numChannels = readLE<uint16_t>(body + 2);
+            info.sampleRate = static_cast<float>(readLE<uint32_t>(body + 4));
+            const uint16_t bitsPerSample = readLE<uint16_t>(body + 14);
+            if (format == wavFormatExtensible && chunkSize >= 26 && available >= 26) {
+                // the format is the first 2 bytes of the sub-format GUID
+                format = readLE<uint16_t>(body + 24);
+            }
+            if (format == wavFormatFloat && bitsPerSample == 32) {
+                info.isFloat = true;
+            } else if (format == wavFormatPCM && bitsPerSample == 16) {
+                info.pcmFormat = PCMFormat::Int16;
+            } else if (format == wavFormatPCM && bitsPerSample == 24) {
+                info.pcmFormat = PCMFormat::Int24;
+            } else if (format == wavFormatPCM && bitsPerSample == 32) {
+                info.pcmFormat = PCMFormat::Int32;
+            } else {
+                OSCILLATORS_THROW(std::invalid_argument("Unsupported WAV sample format"));
+            }
+            info.sampleSize = bitsPerSample / 8;
+            hasFormat = info.numChannels > 0 && info.sampleRate > 0.0f;
+        } else if (isId(chunk, "data")) {
+            if (!hasFormat) {
+                OSCILLATORS_THROW(std::invalid_argument("WAV data before format"));
+            }
+            const uint64_t dataSize = (chunkSize == rf64Size && rf64DataSize) ? rf64DataSize : chunkSize;
+            info.dataOffset = offset + 8;
+            // a file still being written, or truncated, holds less data than announced
+            const uint64_t presentSize = std::min<uint64_t>(dataSize, available);
+            info.numFrames = static_cast<size_t>(presentSize / (info.sampleSize * info.numChannels));
+            return info;
+        }
+        // chunks are padded to an even size
+        offset += 8 + static_cast<size_t>(chunkSize) + (chunkSize & 1);
+    }
+    OSCILLATORS_THROW(std::invalid_argument("No data in WAV file"));
+    return info;
+}
@@ -0,0 +1,56 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef Wav_hpp
+#define Wav_hpp
+
+#include "PCM.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace oscillators_cpp {
+
+/// Layout of the samples of a WAV file (RIFF, or RF64 for files over 4 GB): integer PCM (16, 24 or 32 bits)
+/// or 32-bit float samples, interleaved channels
+struct WavInfo {
+    size_t numChannels;
+    float sampleRate;
+    /// 32-bit float samples (otherwise integer PCM in pcmFormat)
+    bool isFloat;
+    PCMFormat pcmFormat;
+    /// Bytes per sample (of one channel)
+    size_t sampleSize;
+    /// Offset of the first sample in the file
+    size_t dataOffset;
+    /// Number of sample frames (one sample per channel), limited to the data actually present in the file
+    size_t numFrames;
+};
+
+/// Parse the header of the WAV file in data (e.g. a MappedFile), without reading the samples
+WavInfo parseWav(const void *data, size_t size);
+
+} // oscillators_cpp
+
+#endif /* Wav_hpp */
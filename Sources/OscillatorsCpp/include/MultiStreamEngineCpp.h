@@ -0,0 +1,47 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#import <Foundation/Foundation.h>
+
+// Wrapper for the MultiStreamEngine class
+@interface MultiStreamEngineCpp : NSObject
+- (instancetype)initWithMaxStreams:(int)maxStreams numThreads:(int)numThreads;
+- (int)addStreamWithNumResonators:(int)numResonators frequencies:(const float*)frequencies alphas:(const float*)alphas betas:(const float*)betas sampleRate:(float)sampleRate hopSize:(int)hopSize capacity:(int)capacity
+NS_SWIFT_NAME(addStream(numResonators:frequencies:alphas:betas:sampleRate:hopSize:capacity:));
+- (int)numStreams;
+- (int)numThreads;
+- (int)numSharedTables;
+- (void)start;
+- (void)stop;
+- (bool)running;
+- (int)submit:(int)stream frame:(float*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride
+NS_SWIFT_NAME(submit(stream:frameData:frameLength:sampleStride:));
+- (int)getSnapshot:(int)stream powers:(float*)powers amplitudes:(float*)amplitudes phases:(float*)phases size:(int)size
+NS_SWIFT_NAME(getSnapshot(stream:powers:amplitudes:phases:size:));
+- (int)hopsProcessed:(int)stream;
+- (int)overruns:(int)stream;
+- (int)queueDepth:(int)stream;
+- (double)meanLatency:(int)stream;
+- (double)maxLatency:(int)stream;
+@end
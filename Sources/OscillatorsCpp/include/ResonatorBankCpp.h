@@ -27,18 +27,47 @@ SOFTWARE.
 // Wrapper for the ResonatorBank class
 @interface ResonatorBankCpp : NSObject
 - (instancetype)initWithNumResonators:(int)numResonators frequencies:(const float*)frequencies alphas:(const float*)alphas betas:(const float*)betas sampleRate:(float)sampleRate;
+- (instancetype)initWithNumResonators:(int)numResonators frequencies:(const float*)frequencies alphas:(const float*)alphas betas:(const float*)betas sampleRate:(float)sampleRate numThreads:(int)numThreads;
 - (float)sampleRate;
 - (int)numResonators;
+- (int)numThreads;
 - (float)frequencyValue:(int)index;
 - (float)alphaValue:(int)index;
+- (float)betaValue:(int)index;
+- (float)phaseValue:(int)index;
+- (float)trackedFrequencyValue:(int)index;
 - (void)setAllAlphas:(float)alpha;
 - (void)getPowers:(float*)dest size:(int)size;
 - (void)getAmplitudes:(float*)dest size:(int)size;
+- (void)getTrackedFrequencies:(float*)dest size:(int)size;
 - (void)update:(float)sample
 NS_SWIFT_NAME(update(sample:));
 - (void)update:(float*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride
 NS_SWIFT_NAME(update(frameData:frameLength:sampleStride:));
+// Frames of integer PCM samples (little-endian, 24-bit packed in 3 bytes; frameLength and sampleStride in samples),
+// converted on the fly and multiplied by scale (1 / 2^(bits-1) for the full range)
+- (void)updateInt16:(const int16_t*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride scale:(float)scale
+NS_SWIFT_NAME(update(int16Data:frameLength:sampleStride:scale:));
+- (void)updateInt24:(const void*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride scale:(float)scale
+NS_SWIFT_NAME(update(int24Data:frameLength:sampleStride:scale:));
+- (void)updateInt32:(const int32_t*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride scale:(float)scale
+NS_SWIFT_NAME(update(int32Data:frameLength:sampleStride:scale:));
 - (void)updateConcurrent:(float*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride
 NS_SWIFT_NAME(updateConcurrent(frameData:frameLength:sampleStride:));
+- (void)updateAndTrack:(float*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride
+NS_SWIFT_NAME(updateAndTrack(frameData:frameLength:sampleStride:));
+- (void)updateAndTrackConcurrent:(float*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride
+NS_SWIFT_NAME(updateAndTrackConcurrent(frameData:frameLength:sampleStride:));
+- (void)setSnapshotsEnabled:(bool)enabled
+NS_SWIFT_NAME(setSnapshotsEnabled(_:));
+- (bool)snapshotsEnabled;
+- (int)getSnapshotPowers:(float*)powers amplitudes:(float*)amplitudes phases:(float*)phases size:(int)size
+NS_SWIFT_NAME(getSnapshot(powers:amplitudes:phases:size:));
+// Checkpoint of the configuration and state (compact binary blob of checkpointSize() bytes)
+- (int)checkpointSize;
+- (int)saveCheckpoint:(void*)data size:(int)size
+NS_SWIFT_NAME(saveCheckpoint(data:size:));
+- (void)restoreCheckpoint:(const void*)data size:(int)size
+NS_SWIFT_NAME(restoreCheckpoint(data:size:));
 @end
 
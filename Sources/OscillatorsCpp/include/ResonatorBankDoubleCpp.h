@@ -0,0 +1,60 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#import <Foundation/Foundation.h>
+
+// Wrapper for the ResonatorBankDouble class (double precision samples, resonators and results)
+@interface ResonatorBankDoubleCpp : NSObject
+- (instancetype)initWithNumResonators:(int)numResonators frequencies:(const double*)frequencies alphas:(const double*)alphas betas:(const double*)betas sampleRate:(double)sampleRate;
+- (instancetype)initWithNumResonators:(int)numResonators frequencies:(const double*)frequencies alphas:(const double*)alphas betas:(const double*)betas sampleRate:(double)sampleRate numThreads:(int)numThreads;
+- (double)sampleRate;
+- (int)numResonators;
+- (int)numThreads;
+- (double)frequencyValue:(int)index;
+- (double)alphaValue:(int)index;
+- (double)betaValue:(int)index;
+- (double)phaseValue:(int)index;
+- (double)trackedFrequencyValue:(int)index;
+- (void)setAllAlphas:(double)alpha;
+- (void)getPowers:(double*)dest size:(int)size;
+- (void)getAmplitudes:(double*)dest size:(int)size;
+- (void)getTrackedFrequencies:(double*)dest size:(int)size;
+- (void)update:(double)sample
+NS_SWIFT_NAME(update(sample:));
+- (void)update:(double*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride
+NS_SWIFT_NAME(update(frameData:frameLength:sampleStride:));
+- (void)updateConcurrent:(double*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride
+NS_SWIFT_NAME(updateConcurrent(frameData:frameLength:sampleStride:));
+- (void)updateAndTrack:(double*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride
+NS_SWIFT_NAME(updateAndTrack(frameData:frameLength:sampleStride:));
+- (void)updateAndTrackConcurrent:(double*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride
+NS_SWIFT_NAME(updateAndTrackConcurrent(frameData:frameLength:sampleStride:));
+// Checkpoint of the configuration and state (compact binary blob of checkpointSize() bytes, restored into a double precision bank)
+- (int)checkpointSize;
+- (int)saveCheckpoint:(void*)data size:(int)size
+NS_SWIFT_NAME(saveCheckpoint(data:size:));
+- (void)restoreCheckpoint:(const void*)data size:(int)size
+NS_SWIFT_NAME(restoreCheckpoint(data:size:));
+@end
@@ -27,18 +27,94 @@ SOFTWARE.
 // Wrapper for the ResonatorBank class
 @interface ResonatorBankVecCpp : NSObject
 - (instancetype)initWithNumResonators:(int)numResonators frequencies:(const float*)frequencies alphas:(const float*)alphas betas:(const float*)betas sampleRate:(float)sampleRate;
+// Bank in a caller-supplied block of at least arenaSize(numResonators:) bytes, which must outlive the bank
+- (instancetype)initWithNumResonators:(int)numResonators frequencies:(const float*)frequencies alphas:(const float*)alphas betas:(const float*)betas sampleRate:(float)sampleRate arena:(void*)arena arenaSize:(int)arenaSize;
++ (int)arenaSize:(int)numResonators
+NS_SWIFT_NAME(arenaSize(numResonators:));
+// Bank restored from a checkpoint (see saveCheckpoint(data:size:))
+- (instancetype)initWithCheckpoint:(const void*)checkpoint size:(int)size;
 - (float)sampleRate;
 - (int)numResonators;
 - (float)frequencyValue:(int)index;
 - (float)alphaValue:(int)index;
 - (float)betaValue:(int)index;
+- (float)phaseValue:(int)index;
+- (void)setAllAlphas:(float)alpha
+NS_SWIFT_NAME(setAllAlphas(_:));
+// Retuning in place, keeping the state of the resonators (not concurrent with an update)
+- (void)setFrequency:(int)index frequency:(float)frequency
+NS_SWIFT_NAME(setFrequency(index:frequency:));
+- (void)setAlpha:(int)index alpha:(float)alpha
+NS_SWIFT_NAME(setAlpha(index:alpha:));
+- (void)setBeta:(int)index beta:(float)beta
+NS_SWIFT_NAME(setBeta(index:beta:));
+- (void)insertResonator:(int)index frequency:(float)frequency alpha:(float)alpha beta:(float)beta
+NS_SWIFT_NAME(insertResonator(index:frequency:alpha:beta:));
+- (void)removeResonator:(int)index
+NS_SWIFT_NAME(removeResonator(index:));
+- (int)capacity;
+- (NSString*)kernelVariantName;
+// Storage precision of the coefficients read by the frame updates (float32 by default)
+- (void)setFloat32Coefficients;
+- (void)setFloat16Coefficients;
+- (void)setBFloat16Coefficients;
+- (NSString*)coefficientPrecisionName;
+// Accuracy of 16-bit coefficients against float32 over the samples, processed in frames of hop samples: report receives
+// the max frequency error (Hz, relative), max alpha and beta errors (relative), max and mean power errors (relative to the frame's max power)
+- (void)getFloat16PrecisionReport:(float*)report samples:(const float*)samples numSamples:(int)numSamples hop:(int)hop
+NS_SWIFT_NAME(getFloat16PrecisionReport(_:samples:numSamples:hop:));
+- (void)getBFloat16PrecisionReport:(float*)report samples:(const float*)samples numSamples:(int)numSamples hop:(int)hop
+NS_SWIFT_NAME(getBFloat16PrecisionReport(_:samples:numSamples:hop:));
 - (void)getPowers:(float*)dest size:(int)size;
 - (void)getAmplitudes:(float*)dest size:(int)size;
 - (void)update:(float)sample
 NS_SWIFT_NAME(update(sample:));
 - (void)update:(float*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride
 NS_SWIFT_NAME(update(frameData:frameLength:sampleStride:));
+// Frames of integer PCM samples (little-endian, 24-bit packed in 3 bytes; frameLength and sampleStride in samples),
+// converted on the fly and multiplied by scale (1 / 2^(bits-1) for the full range)
+- (void)updateInt16:(const int16_t*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride scale:(float)scale
+NS_SWIFT_NAME(update(int16Data:frameLength:sampleStride:scale:));
+- (void)updateInt24:(const void*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride scale:(float)scale
+NS_SWIFT_NAME(update(int24Data:frameLength:sampleStride:scale:));
+- (void)updateInt32:(const int32_t*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride scale:(float)scale
+NS_SWIFT_NAME(update(int32Data:frameLength:sampleStride:scale:));
 - (void)update:(float*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride powers:(float*)powers amplitudes:(float*)amplitudes
 NS_SWIFT_NAME(update(frameData:frameLength:sampleStride:powers:amplitudes:));
+- (int)update:(float*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride outputInterval:(int)outputInterval powers:(float*)powers amplitudes:(float*)amplitudes
+NS_SWIFT_NAME(update(frameData:frameLength:sampleStride:outputInterval:powers:amplitudes:));
+- (void)updateAndTrack:(float*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride trackedFrequencies:(float*)trackedFrequencies
+NS_SWIFT_NAME(updateAndTrack(frameData:frameLength:sampleStride:trackedFrequencies:));
+- (void)setSilenceThreshold:(float)threshold
+NS_SWIFT_NAME(setSilenceThreshold(_:));
+- (float)silenceThreshold;
+- (void)setPhasorResync:(bool)enabled resyncInterval:(int)resyncInterval
+NS_SWIFT_NAME(setPhasorResync(_:resyncInterval:));
+- (bool)phasorResync;
+- (int)resyncInterval;
+- (void)setNumThreads:(int)numThreads
+NS_SWIFT_NAME(setNumThreads(_:));
+- (int)numThreads;
+- (void)updateConcurrent:(float*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride powers:(float*)powers
+NS_SWIFT_NAME(updateConcurrent(frameData:frameLength:sampleStride:powers:));
+- (void)prepareBatch:(int)blockSize
+NS_SWIFT_NAME(prepareBatch(blockSize:));
+- (void)updateBatch:(float*)data length:(int)length sampleStride:(int)sampleStride powers:(float*)powers
+NS_SWIFT_NAME(updateBatch(data:length:sampleStride:powers:));
+- (int)warmUpLength:(float)tolerance
+NS_SWIFT_NAME(warmUpLength(tolerance:));
+- (int)updateParallel:(float*)data length:(int)length sampleStride:(int)sampleStride outputInterval:(int)outputInterval powers:(float*)powers amplitudes:(float*)amplitudes tolerance:(float)tolerance
+NS_SWIFT_NAME(updateParallel(data:length:sampleStride:outputInterval:powers:amplitudes:tolerance:));
+- (void)setSnapshotsEnabled:(bool)enabled
+NS_SWIFT_NAME(setSnapshotsEnabled(_:));
+- (bool)snapshotsEnabled;
+- (int)getSnapshotPowers:(float*)powers amplitudes:(float*)amplitudes phases:(float*)phases size:(int)size
+NS_SWIFT_NAME(getSnapshot(powers:amplitudes:phases:size:));
+// Checkpoint of the configuration and state (compact binary blob of checkpointSize() bytes)
+- (int)checkpointSize;
+- (int)saveCheckpoint:(void*)data size:(int)size
+NS_SWIFT_NAME(saveCheckpoint(data:size:));
+- (void)restoreCheckpoint:(const void*)data size:(int)size
+NS_SWIFT_NAME(restoreCheckpoint(data:size:));
 @end
 
@@ -0,0 +1,110 @@
+/**
+MIT License
+
+Copyright (c) 2024-2025 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#import <Foundation/Foundation.h>
+
+// Wrapper for the ResonatorBankVecDouble class (double precision samples, coefficients, state and results; snapshots in float)
+@interface ResonatorBankVecDoubleCpp : NSObject
+- (instancetype)initWithNumResonators:(int)numResonators frequencies:(const double*)frequencies alphas:(const double*)alphas betas:(const double*)betas sampleRate:(double)sampleRate;
+// Bank restored from a checkpoint (see saveCheckpoint(data:size:))
+- (instancetype)initWithCheckpoint:(const void*)checkpoint size:(int)size;
+- (double)sampleRate;
+- (int)numResonators;
+- (double)frequencyValue:(int)index;
+- (double)alphaValue:(int)index;
+- (double)betaValue:(int)index;
+- (double)phaseValue:(int)index;
+- (void)setAllAlphas:(double)alpha
+NS_SWIFT_NAME(setAllAlphas(_:));
+// Retuning in place, keeping the state of the resonators (not concurrent with an update)
+- (void)setFrequency:(int)index frequency:(double)frequency
+NS_SWIFT_NAME(setFrequency(index:frequency:));
+- (void)setAlpha:(int)index alpha:(double)alpha
+NS_SWIFT_NAME(setAlpha(index:alpha:));
+- (void)setBeta:(int)index beta:(double)beta
+NS_SWIFT_NAME(setBeta(index:beta:));
+- (void)insertResonator:(int)index frequency:(double)frequency alpha:(double)alpha beta:(double)beta
+NS_SWIFT_NAME(insertResonator(index:frequency:alpha:beta:));
+- (void)removeResonator:(int)index
+NS_SWIFT_NAME(removeResonator(index:));
+- (int)capacity;
+- (NSString*)kernelVariantName;
+// Storage precision of the coefficients read by the frame updates (Float32 by default, i.e. the coefficients in double; 16-bit coefficients are widened to double)
+- (void)setFloat32Coefficients;
+- (void)setFloat16Coefficients;
+- (void)setBFloat16Coefficients;
+- (NSString*)coefficientPrecisionName;
+- (void)getPowers:(double*)dest size:(int)size;
+- (void)getAmplitudes:(double*)dest size:(int)size;
+- (void)update:(double)sample
+NS_SWIFT_NAME(update(sample:));
+- (void)update:(double*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride
+NS_SWIFT_NAME(update(frameData:frameLength:sampleStride:));
+// Frames of integer PCM samples (little-endian, 24-bit packed in 3 bytes; frameLength and sampleStride in samples),
+// converted on the fly and multiplied by scale (1 / 2^(bits-1) for the full range)
+- (void)updateInt16:(const int16_t*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride scale:(float)scale
+NS_SWIFT_NAME(update(int16Data:frameLength:sampleStride:scale:));
+- (void)updateInt24:(const void*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride scale:(float)scale
+NS_SWIFT_NAME(update(int24Data:frameLength:sampleStride:scale:));
+- (void)updateInt32:(const int32_t*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride scale:(float)scale
+NS_SWIFT_NAME(update(int32Data:frameLength:sampleStride:scale:));
+- (void)update:(double*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride powers:(double*)powers amplitudes:(double*)amplitudes
+NS_SWIFT_NAME(update(frameData:frameLength:sampleStride:powers:amplitudes:));
+- (int)update:(double*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride outputInterval:(int)outputInterval powers:(double*)powers amplitudes:(double*)amplitudes
+NS_SWIFT_NAME(update(frameData:frameLength:sampleStride:outputInterval:powers:amplitudes:));
+- (void)updateAndTrack:(double*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride trackedFrequencies:(double*)trackedFrequencies
+NS_SWIFT_NAME(updateAndTrack(frameData:frameLength:sampleStride:trackedFrequencies:));
+- (void)setSilenceThreshold:(double)threshold
+NS_SWIFT_NAME(setSilenceThreshold(_:));
+- (double)silenceThreshold;
+- (void)setPhasorResync:(bool)enabled resyncInterval:(int)resyncInterval
+NS_SWIFT_NAME(setPhasorResync(_:resyncInterval:));
+- (bool)phasorResync;
+- (int)resyncInterval;
+- (void)setNumThreads:(int)numThreads
+NS_SWIFT_NAME(setNumThreads(_:));
+- (int)numThreads;
+- (void)updateConcurrent:(double*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride powers:(double*)powers
+NS_SWIFT_NAME(updateConcurrent(frameData:frameLength:sampleStride:powers:));
+- (void)prepareBatch:(int)blockSize
+NS_SWIFT_NAME(prepareBatch(blockSize:));
+- (void)updateBatch:(double*)data length:(int)length sampleStride:(int)sampleStride powers:(double*)powers
+NS_SWIFT_NAME(updateBatch(data:length:sampleStride:powers:));
+- (int)warmUpLength:(double)tolerance
+NS_SWIFT_NAME(warmUpLength(tolerance:));
+- (int)updateParallel:(double*)data length:(int)length sampleStride:(int)sampleStride outputInterval:(int)outputInterval powers:(double*)powers amplitudes:(double*)amplitudes tolerance:(double)tolerance
+NS_SWIFT_NAME(updateParallel(data:length:sampleStride:outputInterval:powers:amplitudes:tolerance:));
+- (void)setSnapshotsEnabled:(bool)enabled
+NS_SWIFT_NAME(setSnapshotsEnabled(_:));
+- (bool)snapshotsEnabled;
+- (int)getSnapshotPowers:(float*)powers amplitudes:(float*)amplitudes phases:(float*)phases size:(int)size
+NS_SWIFT_NAME(getSnapshot(powers:amplitudes:phases:size:));
+// Checkpoint of the configuration and state (compact binary blob of checkpointSize() bytes, restored into a double precision bank)
+- (int)checkpointSize;
+- (int)saveCheckpoint:(void*)data size:(int)size
+NS_SWIFT_NAME(saveCheckpoint(data:size:));
+- (void)restoreCheckpoint:(const void*)data size:(int)size
+NS_SWIFT_NAME(restoreCheckpoint(data:size:));
+@end
+
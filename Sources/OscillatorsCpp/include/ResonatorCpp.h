@@ -49,4 +49,10 @@ NS_SWIFT_NAME(update(sample:));
 NS_SWIFT_NAME(update(frameData:frameLength:sampleStride:));
 - (void)updateAndTrack:(float*)frame frameLength:(int)frameLength sampleStride:(int)sampleStride
 NS_SWIFT_NAME(updateAndTrack(frameData:frameLength:sampleStride:));
+// Checkpoint of the configuration and state (compact binary blob of checkpointSize() bytes)
+- (int)checkpointSize;
+- (int)saveCheckpoint:(void*)data size:(int)size
+NS_SWIFT_NAME(saveCheckpoint(data:size:));
+- (void)restoreCheckpoint:(const void*)data size:(int)size
+NS_SWIFT_NAME(restoreCheckpoint(data:size:));
 @end
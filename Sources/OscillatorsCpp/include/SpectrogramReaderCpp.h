@@ -0,0 +1,42 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#import <Foundation/Foundation.h>
+
+// Wrapper for the SpectrogramReader class: random access to the frames of a spectrogram file
+@interface SpectrogramReaderCpp : NSObject
+- (instancetype)initWithPath:(NSString*)path;
+- (int)numResonators;
+- (int)numFrames;
+- (int)numChunks;
+- (float)sampleRate;
+- (int)hop;
+- (void)getFrequencies:(float*)dest size:(int)size;
+- (void)getAlphas:(float*)dest size:(int)size;
+- (void)getBetas:(float*)dest size:(int)size;
+// Decode frames [first, first + count) into rows of numResonators values
+- (void)readFrames:(float*)dest first:(int)first count:(int)count
+NS_SWIFT_NAME(readFrames(_:first:count:));
+@end
@@ -0,0 +1,39 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#import <Foundation/Foundation.h>
+
+// Wrapper for the SpectrogramWriter class: appends frames (rows of numResonators values) to a spectrogram file
+@interface SpectrogramWriterCpp : NSObject
+// Half precision values
+- (instancetype)initWithPath:(NSString*)path numResonators:(int)numResonators frequencies:(const float*)frequencies alphas:(const float*)alphas betas:(const float*)betas sampleRate:(float)sampleRate hop:(int)hop framesPerChunk:(int)framesPerChunk;
+// Logarithmic 8-bit values over dynamicRange decibels
+- (instancetype)initLog8WithPath:(NSString*)path numResonators:(int)numResonators frequencies:(const float*)frequencies alphas:(const float*)alphas betas:(const float*)betas sampleRate:(float)sampleRate hop:(int)hop framesPerChunk:(int)framesPerChunk dynamicRange:(float)dynamicRange;
+- (void)append:(const float*)frames numFrames:(int)numFrames
+NS_SWIFT_NAME(append(frames:numFrames:));
+- (void)flush;
+- (void)close;
+- (int)numFrames;
+@end
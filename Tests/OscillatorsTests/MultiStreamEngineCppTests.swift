@@ -0,0 +1,109 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+import XCTest
+@testable import Oscillators
+@testable import OscillatorsCpp
+
+final class MultiStreamEngineCppTests: XCTestCase {
+    func testAddStreams() throws {
+        let engine = MultiStreamEngineCpp(maxStreams: 8, numThreads: 2)
+        guard let engine = engine else { return XCTAssert(false) }
+        XCTAssertEqual(engine.numThreads(), 2)
+        XCTAssertEqual(engine.numStreams(), 0)
+
+        var frequencies = FrequenciesFixtures.frequencies
+        var otherFrequencies = frequencies.map { $0 * 2.0 }
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: frequencies.count)
+        for stream in 0..<6 {
+            let streamId: Int32
+            if stream % 2 == 0 {
+                streamId = engine.addStream(numResonators: Int32(frequencies.count), frequencies: &frequencies, alphas: &alphas, betas: &alphas,
+                                            sampleRate: AudioFixtures.defaultSampleRate, hopSize: 256, capacity: 4096)
+            } else {
+                streamId = engine.addStream(numResonators: Int32(frequencies.count), frequencies: &otherFrequencies, alphas: &alphas, betas: &alphas,
+                                            sampleRate: AudioFixtures.defaultSampleRate, hopSize: 256, capacity: 4096)
+            }
+            XCTAssertEqual(Int(streamId), stream)
+        }
+        XCTAssertEqual(engine.numStreams(), 6)
+        // streams with the same configuration share their tables
+        XCTAssertEqual(engine.numSharedTables(), 2)
+    }
+
+    func testProcessStreams() throws {
+        let engine = MultiStreamEngineCpp(maxStreams: 4, numThreads: 2)
+        var freqs: [Float] = [110.0, 440.0, 1000.0, 5512.5]
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: freqs.count)
+        let resonatorBankVecCpp = ResonatorBankVecCpp(numResonators: (Int32)(freqs.count),
+                                                      frequencies: &freqs,
+                                                      alphas: &alphas,
+                                                      betas: &alphas,
+                                                      sampleRate: AudioFixtures.defaultSampleRate)
+        guard let engine = engine, let resonatorBankVecCpp = resonatorBankVecCpp else { return XCTAssert(false) }
+
+        let hopSize = 128
+        let numHops = 8
+        let numStreams = 4
+        for _ in 0..<numStreams {
+            _ = engine.addStream(numResonators: Int32(freqs.count), frequencies: &freqs, alphas: &alphas, betas: &alphas,
+                                 sampleRate: AudioFixtures.defaultSampleRate, hopSize: Int32(hopSize), capacity: Int32(numHops * hopSize))
+        }
+
+        var frame = [Float](repeating: 0.0, count: hopSize)
+        for index in 0..<hopSize {
+            frame[index] = 0.5 * sin(2.0 * Float.pi * 440.0 * Float(index) / AudioFixtures.defaultSampleRate)
+        }
+        engine.start()
+        XCTAssertTrue(engine.running())
+        for _ in 0..<numHops {
+            for stream in 0..<numStreams {
+                XCTAssertEqual(Int(engine.submit(stream: Int32(stream), frameData: &frame, frameLength: Int32(hopSize), sampleStride: 1)), hopSize)
+            }
+            resonatorBankVecCpp.update(frameData: &frame, frameLength: Int32(hopSize), sampleStride: 1)
+        }
+        let deadline = Date().addingTimeInterval(10.0)
+        while (0..<numStreams).contains(where: { Int(engine.hopsProcessed(Int32($0))) < numHops }) && Date() < deadline {
+            Thread.sleep(forTimeInterval: 0.001)
+        }
+        engine.stop()
+
+        // every stream matches the bank updated hop by hop
+        let size = freqs.count
+        var bankPowers = [Float](repeating: 0.0, count: size)
+        resonatorBankVecCpp.getPowers(&bankPowers, size: Int32(size))
+        var powers = [Float](repeating: 0.0, count: size)
+        for stream in 0..<numStreams {
+            XCTAssertEqual(Int(engine.hopsProcessed(Int32(stream))), numHops)
+            XCTAssertEqual(engine.overruns(Int32(stream)), 0)
+            XCTAssertEqual(engine.queueDepth(Int32(stream)), 0)
+            XCTAssertGreaterThan(engine.maxLatency(Int32(stream)), 0.0)
+            XCTAssertEqual(Int(engine.getSnapshot(stream: Int32(stream), powers: &powers, amplitudes: nil, phases: nil, size: Int32(size))), numHops)
+            for k in 0..<size {
+                XCTAssertEqual(powers[k], bankPowers[k])
+            }
+        }
+    }
+}
@@ -117,4 +117,120 @@ final class ResonatorBankCppTests: XCTestCase {
 
         frame.deallocate()
     }
+
+    func testUpdateConcurrentThreads() throws {
+        let frame = UnsafeMutablePointer<Float>.allocate(capacity: 1024)
+        frame.initialize(repeating: 0.5, count: 1024)
+
+        var freqs = FrequenciesFixtures.frequencies
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: freqs.count)
+        let sequentialBank = ResonatorBankCpp(numResonators: (Int32)(freqs.count),
+                                              frequencies: &freqs,
+                                              alphas: &alphas,
+                                              betas: &alphas,
+                                              sampleRate: AudioFixtures.defaultSampleRate)
+        let concurrentBank = ResonatorBankCpp(numResonators: (Int32)(freqs.count),
+                                              frequencies: &freqs,
+                                              alphas: &alphas,
+                                              betas: &alphas,
+                                              sampleRate: AudioFixtures.defaultSampleRate,
+                                              numThreads: 3)
+        guard let sequentialBank = sequentialBank, let concurrentBank = concurrentBank else { return XCTAssert(false) }
+        XCTAssertEqual(concurrentBank.numThreads(), 3)
+
+        for _ in 0..<4 {
+            sequentialBank.update(frameData: frame, frameLength: 1024, sampleStride: 1)
+            concurrentBank.updateConcurrent(frameData: frame, frameLength: 1024, sampleStride: 1)
+        }
+
+        // contiguous chunks cover all the resonators, each updated exactly once per frame
+        let size = sequentialBank.numResonators()
+        var sequentialPowers = [Float](repeating: 0.0, count: Int(size))
+        var concurrentPowers = [Float](repeating: 0.0, count: Int(size))
+        sequentialBank.getPowers(&sequentialPowers, size: size)
+        concurrentBank.getPowers(&concurrentPowers, size: size)
+        XCTAssertEqual(sequentialPowers, concurrentPowers)
+
+        frame.deallocate()
+    }
+
+    func testUpdateAndTrack() throws {
+        // resonators slightly off the signal frequency
+        var freqs: [Float] = [435.0, 438.0, 442.0, 445.0]
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: freqs.count)
+        let sequentialBank = ResonatorBankCpp(numResonators: (Int32)(freqs.count),
+                                              frequencies: &freqs,
+                                              alphas: &alphas,
+                                              betas: &alphas,
+                                              sampleRate: AudioFixtures.defaultSampleRate)
+        let concurrentBank = ResonatorBankCpp(numResonators: (Int32)(freqs.count),
+                                              frequencies: &freqs,
+                                              alphas: &alphas,
+                                              betas: &alphas,
+                                              sampleRate: AudioFixtures.defaultSampleRate,
+                                              numThreads: 2)
+        guard let sequentialBank = sequentialBank, let concurrentBank = concurrentBank else { return XCTAssert(false) }
+
+        let frameLength = 256
+        var frame = [Float](repeating: 0.0, count: frameLength)
+        var sampleIndex = 0
+        for _ in 0..<400 {
+            for index in 0..<frameLength {
+                frame[index] = 0.5 * sin(2.0 * Float.pi * 440.0 * Float(sampleIndex) / AudioFixtures.defaultSampleRate)
+                sampleIndex += 1
+            }
+            sequentialBank.updateAndTrack(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+            concurrentBank.updateAndTrackConcurrent(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+        }
+
+        let size = sequentialBank.numResonators()
+        var trackedFrequencies = [Float](repeating: 0.0, count: Int(size))
+        sequentialBank.getTrackedFrequencies(&trackedFrequencies, size: size)
+        for index in 0..<size {
+            XCTAssertEqual(trackedFrequencies[Int(index)], 440.0, accuracy: 0.5)
+            XCTAssertEqual(sequentialBank.trackedFrequencyValue(index), concurrentBank.trackedFrequencyValue(index))
+            XCTAssertEqual(sequentialBank.phaseValue(index), concurrentBank.phaseValue(index))
+        }
+    }
+
+    func testCheckpoint() throws {
+        var freqs: [Float] = [110.0, 440.0, 1000.0, 5512.5]
+        var otherFreqs: [Float] = [100.0, 200.0, 300.0, 400.0]
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: freqs.count)
+        let bank = ResonatorBankCpp(numResonators: Int32(freqs.count),
+                                    frequencies: &freqs,
+                                    alphas: &alphas,
+                                    betas: &alphas,
+                                    sampleRate: AudioFixtures.defaultSampleRate)
+        let restoredBank = ResonatorBankCpp(numResonators: Int32(otherFreqs.count),
+                                            frequencies: &otherFreqs,
+                                            alphas: &alphas,
+                                            betas: &alphas,
+                                            sampleRate: AudioFixtures.defaultSampleRate)
+        guard let bank = bank, let restoredBank = restoredBank else { return XCTAssert(false) }
+
+        let frameLength = 1024
+        var frame = [Float](repeating: 0.0, count: frameLength)
+        for index in 0..<frameLength {
+            frame[index] = 0.5 * sin(2.0 * Float.pi * 440.0 * Float(index) / AudioFixtures.defaultSampleRate)
+        }
+        bank.updateAndTrack(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+
+        var checkpoint = [UInt8](repeating: 0, count: Int(bank.checkpointSize()))
+        _ = bank.saveCheckpoint(data: &checkpoint, size: Int32(checkpoint.count))
+        restoredBank.restoreCheckpoint(data: &checkpoint, size: Int32(checkpoint.count))
+        bank.updateAndTrack(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+        restoredBank.updateAndTrack(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+
+        let size = bank.numResonators()
+        var powers = [Float](repeating: 0.0, count: Int(size))
+        var restoredPowers = [Float](repeating: 0.0, count: Int(size))
+        bank.getPowers(&powers, size: size)
+        restoredBank.getPowers(&restoredPowers, size: size)
+        XCTAssertEqual(restoredPowers, powers)
+        for index in 0..<size {
+            XCTAssertEqual(restoredBank.frequencyValue(index), freqs[Int(index)])
+            XCTAssertEqual(restoredBank.trackedFrequencyValue(index), bank.trackedFrequencyValue(index))
+        }
+    }
 }
@@ -0,0 +1,152 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+import XCTest
+@testable import Oscillators
+@testable import OscillatorsCpp
+
+final class ResonatorBankDoubleCppTests: XCTestCase {
+    func testConstructor() throws {
+        var frequencies = FrequenciesFixtures.frequencies.map { Double($0) }
+        var alphas = [Double](repeating: Double(DynamicsFixtures.defaultAlpha), count: frequencies.count)
+        let resonatorBankCpp = ResonatorBankDoubleCpp(numResonators: Int32(frequencies.count),
+                                                      frequencies: &frequencies,
+                                                      alphas: &alphas,
+                                                      betas: &alphas,
+                                                      sampleRate: Double(AudioFixtures.defaultSampleRate))
+        guard let resonatorBankCpp = resonatorBankCpp else { return XCTAssert(false) }
+
+        XCTAssertEqual(Int(resonatorBankCpp.numResonators()), frequencies.count)
+        for index in 0..<resonatorBankCpp.numResonators() {
+            XCTAssertEqual(resonatorBankCpp.frequencyValue(index), frequencies[Int(index)])
+            XCTAssertEqual(resonatorBankCpp.alphaValue(index), Double(DynamicsFixtures.defaultAlpha))
+        }
+    }
+
+    func testUpdate() throws {
+        var frequencies = FrequenciesFixtures.frequencies
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: frequencies.count)
+        var doubleFrequencies = frequencies.map { Double($0) }
+        var doubleAlphas = alphas.map { Double($0) }
+        let floatBank = ResonatorBankCpp(numResonators: Int32(frequencies.count),
+                                         frequencies: &frequencies,
+                                         alphas: &alphas,
+                                         betas: &alphas,
+                                         sampleRate: AudioFixtures.defaultSampleRate)
+        let doubleBank = ResonatorBankDoubleCpp(numResonators: Int32(frequencies.count),
+                                                frequencies: &doubleFrequencies,
+                                                alphas: &doubleAlphas,
+                                                betas: &doubleAlphas,
+                                                sampleRate: Double(AudioFixtures.defaultSampleRate))
+        guard let floatBank = floatBank, let doubleBank = doubleBank else { return XCTAssert(false) }
+
+        let frameLength = 4410
+        var frame = [Float](repeating: 0.0, count: frameLength)
+        for index in 0..<frameLength {
+            frame[index] = 0.5 * sin(2.0 * Float.pi * 440.0 * Float(index) / AudioFixtures.defaultSampleRate)
+        }
+        var doubleFrame = frame.map { Double($0) }
+        floatBank.update(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+        doubleBank.updateConcurrent(frameData: &doubleFrame, frameLength: Int32(frameLength), sampleStride: 1)
+
+        // same results as the float bank, within float precision
+        let size = frequencies.count
+        var powers = [Float](repeating: 0.0, count: size)
+        var doublePowers = [Double](repeating: 0.0, count: size)
+        floatBank.getPowers(&powers, size: Int32(size))
+        doubleBank.getPowers(&doublePowers, size: Int32(size))
+        let maxPower = doublePowers.max() ?? 0.0
+        for index in 0..<size {
+            XCTAssertEqual(Double(powers[index]), doublePowers[index], accuracy: 0.001 * maxPower)
+        }
+    }
+
+    func testLowFrequencyTuning() throws {
+        // 0.5 Hz at 192 kHz: the phasor multiplier of a float resonator is too close to 1 to be tuned accurately,
+        // so the phase of the resonance drifts with a steady input at the resonator's frequency
+        let sampleRate = 192000.0
+        var frequencies = [0.5]
+        var alphas = [0.0001]
+        var floatFrequencies = frequencies.map { Float($0) }
+        var floatAlphas = alphas.map { Float($0) }
+        let doubleBank = ResonatorBankDoubleCpp(numResonators: 1, frequencies: &frequencies, alphas: &alphas, betas: &alphas,
+                                                sampleRate: sampleRate)
+        let floatBank = ResonatorBankCpp(numResonators: 1, frequencies: &floatFrequencies, alphas: &floatAlphas, betas: &floatAlphas,
+                                         sampleRate: Float(sampleRate))
+        guard let doubleBank = doubleBank, let floatBank = floatBank else { return XCTAssert(false) }
+
+        let frameLength = 19200
+        var frame = [Double](repeating: 0.0, count: frameLength)
+        var floatFrame = [Float](repeating: 0.0, count: frameLength)
+        var phases = [Double]()
+        var floatPhases = [Float]()
+        for frameIndex in 0..<100 {
+            for index in 0..<frameLength {
+                frame[index] = sin(2.0 * Double.pi * frequencies[0] * Double(frameIndex * frameLength + index) / sampleRate)
+                floatFrame[index] = Float(frame[index])
+            }
+            doubleBank.updateAndTrack(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+            floatBank.updateAndTrack(frameData: &floatFrame, frameLength: Int32(frameLength), sampleStride: 1)
+            phases.append(doubleBank.phaseValue(0))
+            floatPhases.append(floatBank.phaseValue(0))
+        }
+        // settled after 5 s
+        let drift = abs(phases[99] - phases[49])
+        let floatDrift = abs(Double(floatPhases[99] - floatPhases[49]))
+        XCTAssertLessThan(drift, 1e-6)
+        XCTAssertGreaterThan(floatDrift, drift)
+    }
+
+    func testCheckpoint() throws {
+        var frequencies = [110.0, 440.0, 1000.0]
+        var alphas = [Double](repeating: Double(DynamicsFixtures.defaultAlpha), count: frequencies.count)
+        // a sample rate that float cannot represent, restored exactly
+        let sampleRate = 44100.1
+        func makeBank(sampleRate: Double) -> ResonatorBankDoubleCpp? {
+            return ResonatorBankDoubleCpp(numResonators: Int32(frequencies.count), frequencies: &frequencies, alphas: &alphas, betas: &alphas,
+                                          sampleRate: sampleRate)
+        }
+        guard let bank = makeBank(sampleRate: sampleRate),
+              let restoredBank = makeBank(sampleRate: Double(AudioFixtures.defaultSampleRate)) else { return XCTAssert(false) }
+
+        var frame = [Double](repeating: 0.0, count: 1000)
+        for index in 0..<frame.count {
+            frame[index] = 0.5 * sin(2.0 * Double.pi * 440.0 * Double(index) / Double(AudioFixtures.defaultSampleRate))
+        }
+        bank.update(frameData: &frame, frameLength: Int32(frame.count), sampleStride: 1)
+        var checkpoint = [UInt8](repeating: 0, count: Int(bank.checkpointSize()))
+        XCTAssertEqual(bank.saveCheckpoint(data: &checkpoint, size: Int32(checkpoint.count)), bank.checkpointSize())
+        restoredBank.restoreCheckpoint(data: &checkpoint, size: Int32(checkpoint.count))
+        XCTAssertEqual(restoredBank.sampleRate(), sampleRate)
+
+        // both banks continue identically
+        bank.update(frameData: &frame, frameLength: Int32(frame.count), sampleStride: 1)
+        restoredBank.update(frameData: &frame, frameLength: Int32(frame.count), sampleStride: 1)
+        var powers = [Double](repeating: 0.0, count: frequencies.count)
+        var restoredPowers = [Double](repeating: 0.0, count: frequencies.count)
+        bank.getPowers(&powers, size: Int32(frequencies.count))
+        restoredBank.getPowers(&restoredPowers, size: Int32(frequencies.count))
+        XCTAssertEqual(powers, restoredPowers)
+    }
+}
@@ -0,0 +1,108 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+import XCTest
+@testable import Oscillators
+@testable import OscillatorsCpp
+
+final class ResonatorBankMultichannelCppTests: XCTestCase {
+    func testConstructor() throws {
+        var frequencies = FrequenciesFixtures.frequencies
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: frequencies.count)
+        var betas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: frequencies.count)
+        let resonatorBankCpp = ResonatorBankMultichannelCpp(numChannels: 2,
+                                                            numResonators: (Int32)(frequencies.count),
+                                                            frequencies: &frequencies,
+                                                            alphas: &alphas,
+                                                            betas: &betas,
+                                                            sampleRate: AudioFixtures.defaultSampleRate)
+        guard let resonatorBankCpp = resonatorBankCpp else { return XCTAssert(false) }
+
+        XCTAssertEqual(resonatorBankCpp.numChannels(), 2)
+        XCTAssertEqual((Int)(resonatorBankCpp.numResonators()), frequencies.count)
+        for index in 0..<resonatorBankCpp.numResonators() {
+            XCTAssertEqual(resonatorBankCpp.frequencyValue(index), frequencies[Int(index)])
+            XCTAssertEqual(resonatorBankCpp.alphaValue(index), DynamicsFixtures.defaultAlpha)
+        }
+    }
+
+    func testUpdate() throws {
+        var freqs: [Float] = [110.0, 220.0, 440.0, 880.0]
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: freqs.count)
+        var betas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: freqs.count)
+        let numChannels = 2
+        let multichannelBank = ResonatorBankMultichannelCpp(numChannels: Int32(numChannels),
+                                                            numResonators: (Int32)(freqs.count),
+                                                            frequencies: &freqs,
+                                                            alphas: &alphas,
+                                                            betas: &betas,
+                                                            sampleRate: AudioFixtures.defaultSampleRate)
+        let leftBank = ResonatorBankVecCpp(numResonators: (Int32)(freqs.count),
+                                           frequencies: &freqs,
+                                           alphas: &alphas,
+                                           betas: &betas,
+                                           sampleRate: AudioFixtures.defaultSampleRate)
+        let rightBank = ResonatorBankVecCpp(numResonators: (Int32)(freqs.count),
+                                            frequencies: &freqs,
+                                            alphas: &alphas,
+                                            betas: &betas,
+                                            sampleRate: AudioFixtures.defaultSampleRate)
+        guard let multichannelBank = multichannelBank, let leftBank = leftBank, let rightBank = rightBank else { return XCTAssert(false) }
+
+        // interleaved stereo frame: 220 Hz on the left, 880 Hz on the right
+        let numSamples = 256
+        let frameLength = numSamples * numChannels
+        let frame = UnsafeMutablePointer<Float>.allocate(capacity: frameLength)
+        var sampleIndex = 0
+        for _ in 0..<20 {
+            for index in 0..<numSamples {
+                let t = Float(sampleIndex) / AudioFixtures.defaultSampleRate
+                frame[index * numChannels] = 0.5 * sin(2.0 * Float.pi * 220.0 * t)
+                frame[index * numChannels + 1] = 0.5 * sin(2.0 * Float.pi * 880.0 * t)
+                sampleIndex += 1
+            }
+            multichannelBank.update(frameData: frame, frameLength: Int32(frameLength), sampleStride: Int32(numChannels))
+            leftBank.update(frameData: frame, frameLength: Int32(frameLength), sampleStride: Int32(numChannels))
+            rightBank.update(frameData: frame + 1, frameLength: Int32(frameLength - 1), sampleStride: Int32(numChannels))
+        }
+
+        let size = multichannelBank.numResonators()
+        var powers = [Float](repeating: 0.0, count: numChannels * Int(size))
+        var leftPowers = [Float](repeating: 0.0, count: Int(size))
+        var rightPowers = [Float](repeating: 0.0, count: Int(size))
+        multichannelBank.getPowers(&powers, size: Int32(powers.count))
+        leftBank.getPowers(&leftPowers, size: size)
+        rightBank.getPowers(&rightPowers, size: size)
+        for index in 0..<Int(size) {
+            XCTAssertEqual(powers[index], leftPowers[index], accuracy: 0.00001)
+            XCTAssertEqual(powers[Int(size) + index], rightPowers[index], accuracy: 0.00001)
+        }
+
+        var channelPowers = [Float](repeating: 0.0, count: Int(size))
+        multichannelBank.getChannelPowers(1, dest: &channelPowers, size: size)
+        XCTAssertEqual(channelPowers, rightPowers)
+
+        frame.deallocate()
+    }
+}
@@ -0,0 +1,160 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+import XCTest
+@testable import Oscillators
+@testable import OscillatorsCpp
+
+final class ResonatorBankMultirateCppTests: XCTestCase {
+    func testConstructor() throws {
+        var frequencies = FrequenciesFixtures.frequencies
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: frequencies.count)
+        var betas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: frequencies.count)
+        let resonatorBankCpp = ResonatorBankMultirateCpp(numResonators: (Int32)(frequencies.count),
+                                                         frequencies: &frequencies,
+                                                         alphas: &alphas,
+                                                         betas: &betas,
+                                                         sampleRate: AudioFixtures.defaultSampleRate)
+        guard let resonatorBankCpp = resonatorBankCpp else { return XCTAssert(false) }
+
+        XCTAssertEqual((Int)(resonatorBankCpp.numResonators()), frequencies.count)
+        XCTAssertGreaterThan(resonatorBankCpp.numOctaves(), 0)
+        for index in 0..<resonatorBankCpp.numResonators() {
+            XCTAssertEqual(resonatorBankCpp.frequencyValue(index), frequencies[Int(index)])
+            XCTAssertEqual(resonatorBankCpp.alphaValue(index), DynamicsFixtures.defaultAlpha)
+            // low frequencies run at a lower rate
+            XCTAssertGreaterThan(resonatorBankCpp.decimationValue(index), 1)
+        }
+    }
+
+    func testUpdate() throws {
+        var freqs: [Float] = [55.0, 110.0, 440.0, 5512.5]
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: freqs.count)
+        var betas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: freqs.count)
+        let multirateBank = ResonatorBankMultirateCpp(numResonators: (Int32)(freqs.count),
+                                                      frequencies: &freqs,
+                                                      alphas: &alphas,
+                                                      betas: &betas,
+                                                      sampleRate: AudioFixtures.defaultSampleRate)
+        let fullRateBank = ResonatorBankVecCpp(numResonators: (Int32)(freqs.count),
+                                               frequencies: &freqs,
+                                               alphas: &alphas,
+                                               betas: &betas,
+                                               sampleRate: AudioFixtures.defaultSampleRate)
+        guard let multirateBank = multirateBank, let fullRateBank = fullRateBank else { return XCTAssert(false) }
+
+        let frameLength = 256
+        let frame = UnsafeMutablePointer<Float>.allocate(capacity: frameLength)
+        var sampleIndex = 0
+        for _ in 0..<100 {
+            for index in 0..<frameLength {
+                frame[index] = 0.5 * sin(2.0 * Float.pi * 110.0 * Float(sampleIndex) / AudioFixtures.defaultSampleRate)
+                sampleIndex += 1
+            }
+            multirateBank.update(frameData: frame, frameLength: Int32(frameLength), sampleStride: 1)
+            fullRateBank.update(frameData: frame, frameLength: Int32(frameLength), sampleStride: 1)
+        }
+        // the multirate outputs lag the input by delay() samples
+        let delay = Int(multirateBank.delay())
+        let tail = UnsafeMutablePointer<Float>.allocate(capacity: delay)
+        for index in 0..<delay {
+            tail[index] = 0.5 * sin(2.0 * Float.pi * 110.0 * Float(sampleIndex) / AudioFixtures.defaultSampleRate)
+            sampleIndex += 1
+        }
+        multirateBank.update(frameData: tail, frameLength: Int32(delay), sampleStride: 1)
+        tail.deallocate()
+
+        let size = multirateBank.numResonators()
+        var multirateAmplitudes = [Float](repeating: 0.0, count: Int(size))
+        var fullRateAmplitudes = [Float](repeating: 0.0, count: Int(size))
+        multirateBank.getAmplitudes(&multirateAmplitudes, size: size)
+        fullRateBank.getAmplitudes(&fullRateAmplitudes, size: size)
+        for index in 0..<Int(size) {
+            XCTAssertEqual(multirateAmplitudes[index], fullRateAmplitudes[index], accuracy: 0.001)
+        }
+
+        frame.deallocate()
+    }
+
+    func testOnsetAlignment() throws {
+        // chord starting after 0.1 s, one resonator per group
+        var freqs: [Float] = [30.0, 60.0, 120.0, 480.0, 4000.0]
+        var alphas = [Float](repeating: 1.0 / (AudioFixtures.defaultSampleRate * 0.05), count: freqs.count)
+        let multirateBank = ResonatorBankMultirateCpp(numResonators: (Int32)(freqs.count),
+                                                      frequencies: &freqs,
+                                                      alphas: &alphas,
+                                                      betas: &alphas,
+                                                      sampleRate: AudioFixtures.defaultSampleRate)
+        let fullRateBank = ResonatorBankVecCpp(numResonators: (Int32)(freqs.count),
+                                               frequencies: &freqs,
+                                               alphas: &alphas,
+                                               betas: &alphas,
+                                               sampleRate: AudioFixtures.defaultSampleRate)
+        guard let multirateBank = multirateBank, let fullRateBank = fullRateBank else { return XCTAssert(false) }
+
+        let onset = 4410
+        let length = 2 * Int(AudioFixtures.defaultSampleRate)
+        var signal = [Float](repeating: 0.0, count: length)
+        for index in onset..<length {
+            for frequency in freqs {
+                signal[index] += 0.1 * sin(2.0 * Float.pi * frequency * Float(index - onset) / AudioFixtures.defaultSampleRate)
+            }
+        }
+
+        // amplitudes every hop samples
+        let hop = 64
+        let size = freqs.count
+        var multirateAmplitudes = [[Float]](repeating: [], count: size)
+        var fullRateAmplitudes = [[Float]](repeating: [], count: size)
+        var amplitudes = [Float](repeating: 0.0, count: size)
+        for start in stride(from: 0, to: length, by: hop) {
+            signal.withUnsafeMutableBufferPointer { samples in
+                let frame = samples.baseAddress! + start
+                multirateBank.update(frameData: frame, frameLength: Int32(hop), sampleStride: 1)
+                fullRateBank.update(frameData: frame, frameLength: Int32(hop), sampleStride: 1)
+            }
+            multirateBank.getAmplitudes(&amplitudes, size: Int32(size))
+            for index in 0..<size {
+                multirateAmplitudes[index].append(amplitudes[index])
+            }
+            fullRateBank.getAmplitudes(&amplitudes, size: Int32(size))
+            for index in 0..<size {
+                fullRateAmplitudes[index].append(amplitudes[index])
+            }
+        }
+
+        // every group reaches half its final amplitude delay() samples after the full rate bank,
+        // within a sample period of the group and a hop
+        func halfAmplitudeTime(_ values: [Float]) -> Int {
+            let half = 0.5 * (values.last ?? 0.0)
+            return hop * (values.firstIndex { $0 >= half } ?? 0)
+        }
+        let delay = Int(multirateBank.delay())
+        XCTAssertGreaterThan(delay, 0)
+        for index in 0..<size {
+            let lag = halfAmplitudeTime(multirateAmplitudes[index]) - halfAmplitudeTime(fullRateAmplitudes[index])
+            XCTAssertLessThanOrEqual(abs(lag - delay), Int(multirateBank.decimationValue(Int32(index))) + hop)
+        }
+    }
+}
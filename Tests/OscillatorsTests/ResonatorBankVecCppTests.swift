@@ -42,8 +42,49 @@ final class ResonatorBankVecCppTests: XCTestCase {
         for index in 0..<resonatorBankCpp.numResonators() {
             XCTAssertEqual(resonatorBankCpp.alphaValue(index), DynamicsFixtures.defaultAlpha)
         }
+        XCTAssertFalse(resonatorBankCpp.kernelVariantName().isEmpty)
     }
     
+    func testArena() throws {
+        var frequencies = FrequenciesFixtures.frequencies
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: frequencies.count)
+        // room for the alignment of the block
+        let arenaSize = Int(ResonatorBankVecCpp.arenaSize(numResonators: Int32(frequencies.count))) + 64
+        let arena = UnsafeMutableRawPointer.allocate(byteCount: arenaSize, alignment: 16)
+        defer { arena.deallocate() }
+        let arenaBank = ResonatorBankVecCpp(numResonators: Int32(frequencies.count),
+                                            frequencies: &frequencies,
+                                            alphas: &alphas,
+                                            betas: &alphas,
+                                            sampleRate: AudioFixtures.defaultSampleRate,
+                                            arena: arena,
+                                            arenaSize: Int32(arenaSize))
+        let bank = ResonatorBankVecCpp(numResonators: Int32(frequencies.count),
+                                       frequencies: &frequencies,
+                                       alphas: &alphas,
+                                       betas: &alphas,
+                                       sampleRate: AudioFixtures.defaultSampleRate)
+        guard let arenaBank = arenaBank, let bank = bank else { return XCTAssert(false) }
+
+        let frameLength = 1024
+        var frame = [Float](repeating: 0.0, count: frameLength)
+        for index in 0..<frameLength {
+            frame[index] = 0.5 * sin(2.0 * Float.pi * 440.0 * Float(index) / AudioFixtures.defaultSampleRate)
+        }
+        arenaBank.update(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+        bank.update(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+
+        let size = Int(bank.numResonators())
+        var arenaPowers = [Float](repeating: 0.0, count: size)
+        var powers = [Float](repeating: 0.0, count: size)
+        arenaBank.getPowers(&arenaPowers, size: Int32(size))
+        bank.getPowers(&powers, size: Int32(size))
+        XCTAssertEqual(arenaPowers, powers)
+        for index in 0..<size {
+            XCTAssertEqual(arenaBank.frequencyValue(Int32(index)), frequencies[index])
+        }
+    }
+
     func testUpdate() throws {
         var freqs: [Float] = [5512.5, 6300.0005, 7350.0005, 8820.0]
         var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: freqs.count)
@@ -70,4 +111,700 @@ final class ResonatorBankVecCppTests: XCTestCase {
         
         frame.deallocate()
     }
+
+    func testUpdateBatch() throws {
+        var freqs: [Float] = [110.0, 440.0, 1000.0, 5512.5]
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: freqs.count)
+        var betas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: freqs.count)
+        let sequentialBank = ResonatorBankVecCpp(numResonators: (Int32)(freqs.count),
+                                                 frequencies: &freqs,
+                                                 alphas: &alphas,
+                                                 betas: &betas,
+                                                 sampleRate: AudioFixtures.defaultSampleRate)
+        let batchBank = ResonatorBankVecCpp(numResonators: (Int32)(freqs.count),
+                                            frequencies: &freqs,
+                                            alphas: &alphas,
+                                            betas: &betas,
+                                            sampleRate: AudioFixtures.defaultSampleRate)
+        guard let sequentialBank = sequentialBank, let batchBank = batchBank else { return XCTAssert(false) }
+
+        let length = 8192
+        let blockSize = 256
+        var signal = [Float](repeating: 0.0, count: length)
+        for index in 0..<length {
+            signal[index] = 0.5 * sin(2.0 * Float.pi * 440.0 * Float(index) / AudioFixtures.defaultSampleRate)
+        }
+
+        sequentialBank.update(frameData: &signal, frameLength: Int32(length), sampleStride: 1)
+        batchBank.prepareBatch(blockSize: Int32(blockSize))
+        var powers = [Float](repeating: 0.0, count: length / blockSize * freqs.count)
+        batchBank.updateBatch(data: &signal, length: Int32(length), sampleStride: 1, powers: &powers)
+
+        let size = sequentialBank.numResonators()
+        var sequentialAmplitudes = [Float](repeating: 0.0, count: Int(size))
+        var batchAmplitudes = [Float](repeating: 0.0, count: Int(size))
+        sequentialBank.getAmplitudes(&sequentialAmplitudes, size: size)
+        batchBank.getAmplitudes(&batchAmplitudes, size: size)
+        for index in 0..<Int(size) {
+            XCTAssertEqual(batchAmplitudes[index], sequentialAmplitudes[index], accuracy: 0.0001)
+            // last row of powers is the state after the last block
+            XCTAssertEqual(powers[powers.count - Int(size) + index], batchAmplitudes[index] * batchAmplitudes[index], accuracy: 0.0001)
+        }
+    }
+
+    func testUpdateBatchReducedPrecision() throws {
+        var freqs: [Float] = [110.0, 440.0, 1000.0, 5512.5]
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: freqs.count)
+        func makeBank() -> ResonatorBankVecCpp? {
+            return ResonatorBankVecCpp(numResonators: Int32(freqs.count),
+                                       frequencies: &freqs,
+                                       alphas: &alphas,
+                                       betas: &alphas,
+                                       sampleRate: AudioFixtures.defaultSampleRate)
+        }
+        guard let sequentialBank = makeBank(), let batchBank = makeBank() else { return XCTAssert(false) }
+        sequentialBank.setFloat16Coefficients()
+        batchBank.prepareBatch(blockSize: 256)
+        // the batch weights follow the coefficients read by the frame updates
+        batchBank.setFloat16Coefficients()
+
+        let length = 8192
+        var signal = [Float](repeating: 0.0, count: length)
+        for index in 0..<length {
+            signal[index] = 0.5 * sin(2.0 * Float.pi * 440.0 * Float(index) / AudioFixtures.defaultSampleRate)
+        }
+        sequentialBank.update(frameData: &signal, frameLength: Int32(length), sampleStride: 1)
+        batchBank.updateBatch(data: &signal, length: Int32(length), sampleStride: 1, powers: nil)
+
+        let size = Int(sequentialBank.numResonators())
+        var sequentialAmplitudes = [Float](repeating: 0.0, count: size)
+        var batchAmplitudes = [Float](repeating: 0.0, count: size)
+        sequentialBank.getAmplitudes(&sequentialAmplitudes, size: Int32(size))
+        batchBank.getAmplitudes(&batchAmplitudes, size: Int32(size))
+        for index in 0..<size {
+            XCTAssertEqual(batchAmplitudes[index], sequentialAmplitudes[index], accuracy: 0.00005)
+        }
+    }
+
+    func testUpdateParallel() throws {
+        var freqs: [Float] = [110.0, 440.0, 1000.0, 5512.5]
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: freqs.count)
+        let sequentialBank = ResonatorBankVecCpp(numResonators: (Int32)(freqs.count),
+                                                 frequencies: &freqs,
+                                                 alphas: &alphas,
+                                                 betas: &alphas,
+                                                 sampleRate: AudioFixtures.defaultSampleRate)
+        let parallelBank = ResonatorBankVecCpp(numResonators: (Int32)(freqs.count),
+                                               frequencies: &freqs,
+                                               alphas: &alphas,
+                                               betas: &alphas,
+                                               sampleRate: AudioFixtures.defaultSampleRate)
+        guard let sequentialBank = sequentialBank, let parallelBank = parallelBank else { return XCTAssert(false) }
+        parallelBank.setNumThreads(4)
+
+        let tolerance: Float = 0.0001
+        let warmUpLength = Int(parallelBank.warmUpLength(tolerance: tolerance))
+        XCTAssertGreaterThan(warmUpLength, 0)
+        XCTAssertGreaterThan(Int(parallelBank.warmUpLength(tolerance: tolerance / 10.0)), warmUpLength)
+
+        // long enough for 4 segments
+        let length = 8 * warmUpLength + 1000
+        let outputInterval = 64
+        var signal = [Float](repeating: 0.0, count: length)
+        for index in 0..<length {
+            signal[index] = 0.5 * sin(2.0 * Float.pi * 440.0 * Float(index) / AudioFixtures.defaultSampleRate)
+        }
+        let size = freqs.count
+        let numRows = length / outputInterval
+        var sequentialAmplitudes = [Float](repeating: 0.0, count: numRows * size)
+        var parallelAmplitudes = [Float](repeating: 0.0, count: numRows * size)
+        XCTAssertEqual(Int(sequentialBank.update(frameData: &signal, frameLength: Int32(length), sampleStride: 1,
+                                                 outputInterval: Int32(outputInterval), powers: nil, amplitudes: &sequentialAmplitudes)), numRows)
+        XCTAssertEqual(Int(parallelBank.updateParallel(data: &signal, length: Int32(length), sampleStride: 1,
+                                                       outputInterval: Int32(outputInterval), powers: nil, amplitudes: &parallelAmplitudes,
+                                                       tolerance: tolerance)), numRows)
+        // within tolerance of the signal amplitude, plus float rounding
+        for index in 0..<(numRows * size) {
+            XCTAssertEqual(parallelAmplitudes[index], sequentialAmplitudes[index], accuracy: tolerance + 0.001)
+        }
+
+        // the bank continues from the state at the end of the samples
+        var sequentialFinal = [Float](repeating: 0.0, count: size)
+        var parallelFinal = [Float](repeating: 0.0, count: size)
+        sequentialBank.getAmplitudes(&sequentialFinal, size: Int32(size))
+        parallelBank.getAmplitudes(&parallelFinal, size: Int32(size))
+        for index in 0..<size {
+            XCTAssertEqual(parallelFinal[index], sequentialFinal[index], accuracy: tolerance + 0.001)
+        }
+    }
+
+    func testUpdateParallelPhasorResync() throws {
+        var freqs: [Float] = [110.0, 440.0, 1000.0, 5512.5]
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: freqs.count)
+        let sequentialBank = ResonatorBankVecCpp(numResonators: (Int32)(freqs.count),
+                                                 frequencies: &freqs,
+                                                 alphas: &alphas,
+                                                 betas: &alphas,
+                                                 sampleRate: AudioFixtures.defaultSampleRate)
+        let parallelBank = ResonatorBankVecCpp(numResonators: (Int32)(freqs.count),
+                                               frequencies: &freqs,
+                                               alphas: &alphas,
+                                               betas: &alphas,
+                                               sampleRate: AudioFixtures.defaultSampleRate)
+        guard let sequentialBank = sequentialBank, let parallelBank = parallelBank else { return XCTAssert(false) }
+        parallelBank.setNumThreads(4)
+        let resyncInterval = 1024
+        sequentialBank.setPhasorResync(true, resyncInterval: Int32(resyncInterval))
+        parallelBank.setPhasorResync(true, resyncInterval: Int32(resyncInterval))
+
+        // long enough for 4 segments, not a whole number of resync intervals
+        let tolerance: Float = 0.0001
+        let length = 8 * Int(parallelBank.warmUpLength(tolerance: tolerance)) + 1000
+        let outputInterval = 64
+        var signal = [Float](repeating: 0.0, count: length)
+        for index in 0..<length {
+            signal[index] = 0.5 * sin(2.0 * Float.pi * 440.0 * Float(index) / AudioFixtures.defaultSampleRate)
+        }
+        let size = freqs.count
+        let numRows = length / outputInterval
+        var sequentialAmplitudes = [Float](repeating: 0.0, count: numRows * size)
+        var parallelAmplitudes = [Float](repeating: 0.0, count: numRows * size)
+        XCTAssertEqual(Int(sequentialBank.update(frameData: &signal, frameLength: Int32(length), sampleStride: 1,
+                                                 outputInterval: Int32(outputInterval), powers: nil, amplitudes: &sequentialAmplitudes)), numRows)
+        XCTAssertEqual(Int(parallelBank.updateParallel(data: &signal, length: Int32(length), sampleStride: 1,
+                                                       outputInterval: Int32(outputInterval), powers: nil, amplitudes: &parallelAmplitudes,
+                                                       tolerance: tolerance)), numRows)
+        for index in 0..<(numRows * size) {
+            XCTAssertEqual(parallelAmplitudes[index], sequentialAmplitudes[index], accuracy: tolerance + 0.001)
+        }
+        XCTAssertEqual(parallelBank.resyncInterval(), sequentialBank.resyncInterval())
+
+        // the resync schedule continues from the end of the samples: further frames give the same results
+        let frameLength = 3 * resyncInterval / 2
+        var frame = [Float](repeating: 0.0, count: frameLength)
+        for _ in 0..<4 {
+            for index in 0..<frameLength {
+                frame[index] = 0.5 * sin(2.0 * Float.pi * 1000.0 * Float(index) / AudioFixtures.defaultSampleRate)
+            }
+            sequentialBank.update(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+            parallelBank.update(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+        }
+        var sequentialFinal = [Float](repeating: 0.0, count: size)
+        var parallelFinal = [Float](repeating: 0.0, count: size)
+        sequentialBank.getAmplitudes(&sequentialFinal, size: Int32(size))
+        parallelBank.getAmplitudes(&parallelFinal, size: Int32(size))
+        for index in 0..<size {
+            XCTAssertEqual(parallelFinal[index], sequentialFinal[index], accuracy: tolerance + 0.001)
+        }
+    }
+
+    func testUpdateConcurrent() throws {
+        // large enough for several shards
+        let numResonators = 3000
+        var freqs = (0..<numResonators).map { Float(20.0 + 6.0 * Double($0)) }
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: numResonators)
+        let sequentialBank = ResonatorBankVecCpp(numResonators: Int32(numResonators),
+                                                 frequencies: &freqs,
+                                                 alphas: &alphas,
+                                                 betas: &alphas,
+                                                 sampleRate: AudioFixtures.defaultSampleRate)
+        let concurrentBank = ResonatorBankVecCpp(numResonators: Int32(numResonators),
+                                                 frequencies: &freqs,
+                                                 alphas: &alphas,
+                                                 betas: &alphas,
+                                                 sampleRate: AudioFixtures.defaultSampleRate)
+        guard let sequentialBank = sequentialBank, let concurrentBank = concurrentBank else { return XCTAssert(false) }
+        concurrentBank.setNumThreads(4)
+        XCTAssertEqual(concurrentBank.numThreads(), 4)
+
+        let frameLength = 256
+        var frame = [Float](repeating: 0.0, count: frameLength)
+        var concurrentPowers = [Float](repeating: 0.0, count: numResonators)
+        var sampleIndex = 0
+        for _ in 0..<10 {
+            for index in 0..<frameLength {
+                frame[index] = 0.5 * sin(2.0 * Float.pi * 440.0 * Float(sampleIndex) / AudioFixtures.defaultSampleRate)
+                sampleIndex += 1
+            }
+            sequentialBank.update(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+            concurrentBank.updateConcurrent(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1, powers: &concurrentPowers)
+        }
+
+        var sequentialPowers = [Float](repeating: 0.0, count: numResonators)
+        sequentialBank.getPowers(&sequentialPowers, size: Int32(numResonators))
+        XCTAssertEqual(concurrentPowers, sequentialPowers)
+    }
+
+    func testUpdateAndTrack() throws {
+        var freqs: [Float] = [100.0, 435.0, 438.0, 442.0, 445.0]
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: freqs.count)
+        let vecBank = ResonatorBankVecCpp(numResonators: (Int32)(freqs.count),
+                                          frequencies: &freqs,
+                                          alphas: &alphas,
+                                          betas: &alphas,
+                                          sampleRate: AudioFixtures.defaultSampleRate)
+        let objectBank = ResonatorBankCpp(numResonators: (Int32)(freqs.count),
+                                          frequencies: &freqs,
+                                          alphas: &alphas,
+                                          betas: &alphas,
+                                          sampleRate: AudioFixtures.defaultSampleRate)
+        guard let vecBank = vecBank, let objectBank = objectBank else { return XCTAssert(false) }
+
+        let frameLength = 256
+        var frame = [Float](repeating: 0.0, count: frameLength)
+        var trackedFrequencies = [Float](repeating: 0.0, count: freqs.count)
+        var sampleIndex = 0
+        for _ in 0..<400 {
+            for index in 0..<frameLength {
+                frame[index] = 0.5 * sin(2.0 * Float.pi * 440.0 * Float(sampleIndex) / AudioFixtures.defaultSampleRate)
+                sampleIndex += 1
+            }
+            vecBank.updateAndTrack(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1, trackedFrequencies: &trackedFrequencies)
+            objectBank.updateAndTrack(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+        }
+
+        for index in 0..<freqs.count {
+            XCTAssertEqual(trackedFrequencies[index], objectBank.trackedFrequencyValue(Int32(index)), accuracy: 0.01)
+            XCTAssertEqual(vecBank.phaseValue(Int32(index)), objectBank.phaseValue(Int32(index)), accuracy: 0.01)
+        }
+        // resonators near the signal frequency track it
+        for index in 1..<freqs.count {
+            XCTAssertEqual(trackedFrequencies[index], 440.0, accuracy: 0.5)
+        }
+    }
+
+    func testUpdateWithOutput() throws {
+        var freqs: [Float] = [110.0, 440.0, 1000.0, 5512.5]
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: freqs.count)
+        let sampleBank = ResonatorBankVecCpp(numResonators: (Int32)(freqs.count),
+                                             frequencies: &freqs,
+                                             alphas: &alphas,
+                                             betas: &alphas,
+                                             sampleRate: AudioFixtures.defaultSampleRate)
+        let outputBank = ResonatorBankVecCpp(numResonators: (Int32)(freqs.count),
+                                             frequencies: &freqs,
+                                             alphas: &alphas,
+                                             betas: &alphas,
+                                             sampleRate: AudioFixtures.defaultSampleRate)
+        guard let sampleBank = sampleBank, let outputBank = outputBank else { return XCTAssert(false) }
+
+        let frameLength = 100
+        let outputInterval = 8
+        var frame = [Float](repeating: 0.0, count: frameLength)
+        for index in 0..<frameLength {
+            frame[index] = 0.5 * sin(2.0 * Float.pi * 440.0 * Float(index) / AudioFixtures.defaultSampleRate)
+        }
+        let size = Int(outputBank.numResonators())
+        var powers = [Float](repeating: 0.0, count: (frameLength / outputInterval + 1) * size)
+        let numRows = outputBank.update(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1,
+                                        outputInterval: Int32(outputInterval), powers: &powers, amplitudes: nil)
+        XCTAssertEqual(Int(numRows), frameLength / outputInterval)
+
+        // same values as updating sample by sample and reading the powers every outputInterval samples
+        var samplePowers = [Float](repeating: 0.0, count: size)
+        for index in 0..<frameLength {
+            sampleBank.update(sample: frame[index])
+            if (index + 1) % outputInterval == 0 {
+                sampleBank.getPowers(&samplePowers, size: Int32(size))
+                let row = (index + 1) / outputInterval - 1
+                for k in 0..<size {
+                    XCTAssertEqual(powers[row * size + k], samplePowers[k], accuracy: 0.000001)
+                }
+            }
+        }
+    }
+
+    func testUpdateWithSilence() throws {
+        var freqs: [Float] = [110.0, 440.0, 1000.0, 5512.5]
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: freqs.count)
+        let sampleBank = ResonatorBankVecCpp(numResonators: (Int32)(freqs.count),
+                                             frequencies: &freqs,
+                                             alphas: &alphas,
+                                             betas: &alphas,
+                                             sampleRate: AudioFixtures.defaultSampleRate)
+        let frameBank = ResonatorBankVecCpp(numResonators: (Int32)(freqs.count),
+                                            frequencies: &freqs,
+                                            alphas: &alphas,
+                                            betas: &alphas,
+                                            sampleRate: AudioFixtures.defaultSampleRate)
+        guard let sampleBank = sampleBank, let frameBank = frameBank else { return XCTAssert(false) }
+        XCTAssertEqual(frameBank.silenceThreshold(), 0.0)
+
+        // a tone burst followed by silence: the silent run is skipped in closed form
+        let frameLength = 2000
+        var frame = [Float](repeating: 0.0, count: frameLength)
+        for index in 0..<500 {
+            frame[index] = 0.5 * sin(2.0 * Float.pi * 440.0 * Float(index) / AudioFixtures.defaultSampleRate)
+        }
+        frameBank.update(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+        for index in 0..<frameLength {
+            sampleBank.update(sample: frame[index])
+        }
+
+        let size = Int(frameBank.numResonators())
+        var framePowers = [Float](repeating: 0.0, count: size)
+        var samplePowers = [Float](repeating: 0.0, count: size)
+        frameBank.getPowers(&framePowers, size: Int32(size))
+        sampleBank.getPowers(&samplePowers, size: Int32(size))
+        for k in 0..<size {
+            XCTAssertEqual(framePowers[k], samplePowers[k], accuracy: 0.000001)
+        }
+    }
+
+    func testUpdateWithOutputAndSilence() throws {
+        var freqs: [Float] = [110.0, 440.0, 1000.0, 5512.5]
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: freqs.count)
+        let sampleBank = ResonatorBankVecCpp(numResonators: (Int32)(freqs.count),
+                                             frequencies: &freqs,
+                                             alphas: &alphas,
+                                             betas: &alphas,
+                                             sampleRate: AudioFixtures.defaultSampleRate)
+        let outputBank = ResonatorBankVecCpp(numResonators: (Int32)(freqs.count),
+                                             frequencies: &freqs,
+                                             alphas: &alphas,
+                                             betas: &alphas,
+                                             sampleRate: AudioFixtures.defaultSampleRate)
+        guard let sampleBank = sampleBank, let outputBank = outputBank else { return XCTAssert(false) }
+
+        // a tone burst followed by silence: the outputs within the silent run are computed after closed form jumps
+        let frameLength = 2000
+        let outputInterval = 100
+        var frame = [Float](repeating: 0.0, count: frameLength)
+        for index in 0..<500 {
+            frame[index] = 0.5 * sin(2.0 * Float.pi * 440.0 * Float(index) / AudioFixtures.defaultSampleRate)
+        }
+        let size = Int(outputBank.numResonators())
+        var powers = [Float](repeating: 0.0, count: (frameLength / outputInterval) * size)
+        let numRows = outputBank.update(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1,
+                                        outputInterval: Int32(outputInterval), powers: &powers, amplitudes: nil)
+        XCTAssertEqual(Int(numRows), frameLength / outputInterval)
+
+        var samplePowers = [Float](repeating: 0.0, count: size)
+        for index in 0..<frameLength {
+            sampleBank.update(sample: frame[index])
+            if (index + 1) % outputInterval == 0 {
+                sampleBank.getPowers(&samplePowers, size: Int32(size))
+                let row = (index + 1) / outputInterval - 1
+                for k in 0..<size {
+                    XCTAssertEqual(powers[row * size + k], samplePowers[k], accuracy: 0.000001)
+                }
+            }
+        }
+    }
+
+    func testPhasorResync() throws {
+        var freqs: [Float] = [110.0, 440.0, 1000.0, 5512.5]
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: freqs.count)
+        let stabilizedBank = ResonatorBankVecCpp(numResonators: (Int32)(freqs.count),
+                                                 frequencies: &freqs,
+                                                 alphas: &alphas,
+                                                 betas: &alphas,
+                                                 sampleRate: AudioFixtures.defaultSampleRate)
+        let resyncBank = ResonatorBankVecCpp(numResonators: (Int32)(freqs.count),
+                                             frequencies: &freqs,
+                                             alphas: &alphas,
+                                             betas: &alphas,
+                                             sampleRate: AudioFixtures.defaultSampleRate)
+        guard let stabilizedBank = stabilizedBank, let resyncBank = resyncBank else { return XCTAssert(false) }
+        XCTAssertFalse(resyncBank.phasorResync())
+        resyncBank.setPhasorResync(true, resyncInterval: 1024)
+        XCTAssertTrue(resyncBank.phasorResync())
+        XCTAssertEqual(resyncBank.resyncInterval(), 1024)
+
+        let frameLength = 256
+        var frame = [Float](repeating: 0.0, count: frameLength)
+        for index in 0..<frameLength {
+            frame[index] = 0.5 * sin(2.0 * Float.pi * 440.0 * Float(index) / AudioFixtures.defaultSampleRate)
+        }
+        for _ in 0..<100 {
+            stabilizedBank.update(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+            resyncBank.update(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+        }
+
+        let size = Int(resyncBank.numResonators())
+        var stabilizedPowers = [Float](repeating: 0.0, count: size)
+        var resyncPowers = [Float](repeating: 0.0, count: size)
+        stabilizedBank.getPowers(&stabilizedPowers, size: Int32(size))
+        resyncBank.getPowers(&resyncPowers, size: Int32(size))
+        for k in 0..<size {
+            XCTAssertEqual(resyncPowers[k], stabilizedPowers[k], accuracy: 0.0001)
+        }
+    }
+
+    func testSnapshot() throws {
+        var freqs: [Float] = [110.0, 440.0, 1000.0, 5512.5]
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: freqs.count)
+        let resonatorBankVecCpp = ResonatorBankVecCpp(numResonators: (Int32)(freqs.count),
+                                                      frequencies: &freqs,
+                                                      alphas: &alphas,
+                                                      betas: &alphas,
+                                                      sampleRate: AudioFixtures.defaultSampleRate)
+        guard let resonatorBankVecCpp = resonatorBankVecCpp else { return XCTAssert(false) }
+
+        let size = Int(resonatorBankVecCpp.numResonators())
+        var powers = [Float](repeating: 0.0, count: size)
+        var amplitudes = [Float](repeating: 0.0, count: size)
+        var phases = [Float](repeating: 0.0, count: size)
+        XCTAssertFalse(resonatorBankVecCpp.snapshotsEnabled())
+        resonatorBankVecCpp.setSnapshotsEnabled(true)
+        XCTAssertTrue(resonatorBankVecCpp.snapshotsEnabled())
+        XCTAssertEqual(resonatorBankVecCpp.getSnapshot(powers: &powers, amplitudes: &amplitudes, phases: &phases, size: Int32(size)), 0)
+
+        let frameLength = 256
+        var frame = [Float](repeating: 0.0, count: frameLength)
+        for index in 0..<frameLength {
+            frame[index] = 0.5 * sin(2.0 * Float.pi * 440.0 * Float(index) / AudioFixtures.defaultSampleRate)
+        }
+        for _ in 0..<3 {
+            resonatorBankVecCpp.update(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+        }
+        XCTAssertEqual(resonatorBankVecCpp.getSnapshot(powers: &powers, amplitudes: &amplitudes, phases: &phases, size: Int32(size)), 3)
+
+        // same values as the bank after the last frame
+        var bankPowers = [Float](repeating: 0.0, count: size)
+        var bankAmplitudes = [Float](repeating: 0.0, count: size)
+        resonatorBankVecCpp.getPowers(&bankPowers, size: Int32(size))
+        resonatorBankVecCpp.getAmplitudes(&bankAmplitudes, size: Int32(size))
+        for k in 0..<size {
+            XCTAssertEqual(powers[k], bankPowers[k])
+            XCTAssertEqual(amplitudes[k], bankAmplitudes[k])
+            XCTAssertLessThanOrEqual(abs(phases[k]), Float.pi)
+        }
+    }
+
+    func testRetune() throws {
+        var freqs: [Float] = [110.0, 440.0, 1000.0, 5512.5]
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: freqs.count)
+        let bank = ResonatorBankVecCpp(numResonators: Int32(freqs.count),
+                                       frequencies: &freqs,
+                                       alphas: &alphas,
+                                       betas: &alphas,
+                                       sampleRate: AudioFixtures.defaultSampleRate)
+        guard let bank = bank else { return XCTAssert(false) }
+        bank.setFrequency(index: 1, frequency: 880.0)
+        bank.setAlpha(index: 2, alpha: 2.0 * DynamicsFixtures.defaultAlpha)
+        bank.setBeta(index: 3, beta: 0.5 * DynamicsFixtures.defaultAlpha)
+        XCTAssertEqual(bank.frequencyValue(1), 880.0)
+        XCTAssertEqual(bank.alphaValue(2), 2.0 * DynamicsFixtures.defaultAlpha)
+        XCTAssertEqual(bank.betaValue(3), 0.5 * DynamicsFixtures.defaultAlpha)
+
+        // same as a bank constructed with the new values
+        var retunedFreqs: [Float] = [110.0, 880.0, 1000.0, 5512.5]
+        var retunedAlphas = alphas
+        retunedAlphas[2] = 2.0 * DynamicsFixtures.defaultAlpha
+        var retunedBetas = alphas
+        retunedBetas[3] = 0.5 * DynamicsFixtures.defaultAlpha
+        let reference = ResonatorBankVecCpp(numResonators: Int32(retunedFreqs.count),
+                                            frequencies: &retunedFreqs,
+                                            alphas: &retunedAlphas,
+                                            betas: &retunedBetas,
+                                            sampleRate: AudioFixtures.defaultSampleRate)
+        guard let reference = reference else { return XCTAssert(false) }
+
+        let frameLength = 1024
+        var frame = [Float](repeating: 0.0, count: frameLength)
+        for index in 0..<frameLength {
+            frame[index] = 0.5 * sin(2.0 * Float.pi * 880.0 * Float(index) / AudioFixtures.defaultSampleRate)
+        }
+        bank.update(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+        reference.update(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+
+        let size = Int(bank.numResonators())
+        var powers = [Float](repeating: 0.0, count: size)
+        var referencePowers = [Float](repeating: 0.0, count: size)
+        bank.getPowers(&powers, size: Int32(size))
+        reference.getPowers(&referencePowers, size: Int32(size))
+        XCTAssertEqual(powers, referencePowers)
+    }
+
+    func testInsertRemove() throws {
+        var freqs: [Float] = [110.0, 440.0, 1000.0, 5512.5]
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: freqs.count)
+        let bank = ResonatorBankVecCpp(numResonators: Int32(freqs.count),
+                                       frequencies: &freqs,
+                                       alphas: &alphas,
+                                       betas: &alphas,
+                                       sampleRate: AudioFixtures.defaultSampleRate)
+        let reference = ResonatorBankVecCpp(numResonators: Int32(freqs.count),
+                                            frequencies: &freqs,
+                                            alphas: &alphas,
+                                            betas: &alphas,
+                                            sampleRate: AudioFixtures.defaultSampleRate)
+        guard let bank = bank, let reference = reference else { return XCTAssert(false) }
+        XCTAssertEqual(bank.capacity(), 32)
+
+        let frameLength = 1024
+        var frame = [Float](repeating: 0.0, count: frameLength)
+        for index in 0..<frameLength {
+            frame[index] = 0.5 * sin(2.0 * Float.pi * 440.0 * Float(index) / AudioFixtures.defaultSampleRate)
+        }
+        bank.update(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+        reference.update(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+
+        // past the initial capacity
+        for index in 0..<40 {
+            bank.insertResonator(index: 2, frequency: 2000.0 + 10.0 * Float(index),
+                                 alpha: DynamicsFixtures.defaultAlpha, beta: DynamicsFixtures.defaultAlpha)
+        }
+        XCTAssertEqual(bank.numResonators(), 44)
+        XCTAssertEqual(bank.capacity(), 64)
+        XCTAssertEqual(bank.frequencyValue(2), 2390.0)
+        XCTAssertEqual(bank.frequencyValue(42), 1000.0)
+        for _ in 0..<40 {
+            bank.removeResonator(index: 2)
+        }
+        XCTAssertEqual(bank.numResonators(), 4)
+
+        // the other resonators kept their state
+        bank.update(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+        reference.update(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+        let size = Int(bank.numResonators())
+        var powers = [Float](repeating: 0.0, count: size)
+        var referencePowers = [Float](repeating: 0.0, count: size)
+        bank.getPowers(&powers, size: Int32(size))
+        reference.getPowers(&referencePowers, size: Int32(size))
+        for index in 0..<size {
+            XCTAssertEqual(bank.frequencyValue(Int32(index)), freqs[index])
+            XCTAssertEqual(powers[index], referencePowers[index], accuracy: 1e-6)
+        }
+    }
+
+    func testCheckpoint() throws {
+        var freqs = FrequenciesFixtures.frequencies
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: freqs.count)
+        let bank = ResonatorBankVecCpp(numResonators: Int32(freqs.count),
+                                       frequencies: &freqs,
+                                       alphas: &alphas,
+                                       betas: &alphas,
+                                       sampleRate: AudioFixtures.defaultSampleRate)
+        let restoredBank = ResonatorBankVecCpp(numResonators: Int32(freqs.count),
+                                               frequencies: &freqs,
+                                               alphas: &alphas,
+                                               betas: &alphas,
+                                               sampleRate: AudioFixtures.defaultSampleRate)
+        guard let bank = bank, let restoredBank = restoredBank else { return XCTAssert(false) }
+        bank.setPhasorResync(true, resyncInterval: 0)
+
+        let frameLength = 1024
+        var frame = [Float](repeating: 0.0, count: frameLength)
+        for index in 0..<frameLength {
+            frame[index] = 0.5 * sin(2.0 * Float.pi * 440.0 * Float(index) / AudioFixtures.defaultSampleRate)
+        }
+        bank.update(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+
+        var checkpoint = [UInt8](repeating: 0, count: Int(bank.checkpointSize()))
+        XCTAssertEqual(bank.saveCheckpoint(data: &checkpoint, size: Int32(checkpoint.count)), bank.checkpointSize())
+        restoredBank.restoreCheckpoint(data: &checkpoint, size: Int32(checkpoint.count))
+        let newBank = ResonatorBankVecCpp(checkpoint: &checkpoint, size: Int32(checkpoint.count))
+        guard let newBank = newBank else { return XCTAssert(false) }
+        XCTAssertEqual(newBank.numResonators(), bank.numResonators())
+
+        // same results as the bank that was checkpointed, without warm-up
+        let size = Int(bank.numResonators())
+        var powers = [Float](repeating: 0.0, count: size)
+        var restoredPowers = [Float](repeating: 0.0, count: size)
+        var newPowers = [Float](repeating: 0.0, count: size)
+        for _ in 0..<3 {
+            bank.update(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+            restoredBank.update(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+            newBank.update(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+        }
+        bank.getPowers(&powers, size: Int32(size))
+        restoredBank.getPowers(&restoredPowers, size: Int32(size))
+        newBank.getPowers(&newPowers, size: Int32(size))
+        XCTAssertEqual(restoredPowers, powers)
+        XCTAssertEqual(newPowers, powers)
+    }
+
+    func testUpdatePCM() throws {
+        var freqs: [Float] = [110.0, 440.0, 1000.0, 5512.5]
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: freqs.count)
+        func makeBank() -> ResonatorBankVecCpp? {
+            return ResonatorBankVecCpp(numResonators: Int32(freqs.count),
+                                       frequencies: &freqs,
+                                       alphas: &alphas,
+                                       betas: &alphas,
+                                       sampleRate: AudioFixtures.defaultSampleRate)
+        }
+        guard let floatBank = makeBank(), let int16Bank = makeBank(), let int24Bank = makeBank() else { return XCTAssert(false) }
+
+        // stereo frames, the right channel is analyzed
+        let frameLength = 2048
+        var floatFrame = [Float](repeating: 0.0, count: frameLength)
+        var int16Frame = [Int16](repeating: 0, count: 2 * frameLength)
+        var int24Frame = [UInt8](repeating: 0, count: 6 * frameLength)
+        for index in 0..<frameLength {
+            let value = Int32(8388607.0 * 0.5 * sin(2.0 * Float.pi * 440.0 * Float(index) / AudioFixtures.defaultSampleRate))
+            int16Frame[2 * index + 1] = Int16(value >> 8)
+            floatFrame[index] = Float(value >> 8) / 32768.0
+            for byte in 0..<3 {
+                int24Frame[6 * index + 3 + byte] = UInt8(truncatingIfNeeded: value >> (8 * byte))
+            }
+        }
+        floatBank.update(frameData: &floatFrame, frameLength: Int32(frameLength), sampleStride: 1)
+        int16Frame.withUnsafeBufferPointer { samples in
+            int16Bank.update(int16Data: samples.baseAddress! + 1, frameLength: Int32(2 * frameLength - 1), sampleStride: 2, scale: 1.0 / 32768.0)
+        }
+        int24Frame.withUnsafeBytes { bytes in
+            int24Bank.update(int24Data: bytes.baseAddress! + 3, frameLength: Int32(2 * frameLength - 1), sampleStride: 2, scale: 1.0 / 8388608.0)
+        }
+
+        let size = Int(floatBank.numResonators())
+        var powers = [Float](repeating: 0.0, count: size)
+        var int16Powers = [Float](repeating: 0.0, count: size)
+        var int24Powers = [Float](repeating: 0.0, count: size)
+        floatBank.getPowers(&powers, size: Int32(size))
+        int16Bank.getPowers(&int16Powers, size: Int32(size))
+        int24Bank.getPowers(&int24Powers, size: Int32(size))
+        XCTAssertEqual(int16Powers, powers)
+        for index in 0..<size {
+            XCTAssertEqual(int24Powers[index], powers[index], accuracy: 1e-3 * powers[1])
+        }
+    }
+
+    func testReducedPrecisionCoefficients() throws {
+        var frequencies = FrequenciesFixtures.frequencies
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: frequencies.count)
+        func makeBank() -> ResonatorBankVecCpp? {
+            return ResonatorBankVecCpp(numResonators: Int32(frequencies.count),
+                                       frequencies: &frequencies,
+                                       alphas: &alphas,
+                                       betas: &alphas,
+                                       sampleRate: AudioFixtures.defaultSampleRate)
+        }
+        guard let floatBank = makeBank(), let halfBank = makeBank() else { return XCTAssert(false) }
+        XCTAssertEqual(floatBank.coefficientPrecisionName(), "Float32")
+        halfBank.setFloat16Coefficients()
+        XCTAssertEqual(halfBank.coefficientPrecisionName(), "Float16")
+
+        let frameLength = Int(AudioFixtures.defaultSampleRate)
+        var frame = [Float](repeating: 0.0, count: frameLength)
+        for index in 0..<frameLength {
+            frame[index] = 0.5 * sin(2.0 * Float.pi * 440.0 * Float(index) / AudioFixtures.defaultSampleRate)
+        }
+        floatBank.update(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+        halfBank.update(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+
+        let size = Int(floatBank.numResonators())
+        var powers = [Float](repeating: 0.0, count: size)
+        var halfPowers = [Float](repeating: 0.0, count: size)
+        floatBank.getPowers(&powers, size: Int32(size))
+        halfBank.getPowers(&halfPowers, size: Int32(size))
+        // the float16 phasor multipliers detune the resonators by up to 5e-4 relative: about 3% of the power
+        // at the peak for the default alpha
+        let maxPower = powers.max() ?? 0.0
+        for index in 0..<size {
+            XCTAssertEqual(halfPowers[index], powers[index], accuracy: 0.05 * maxPower)
+        }
+
+        // bfloat16 keeps fewer mantissa bits than float16
+        var halfReport = [Float](repeating: 0.0, count: 6)
+        var bfloatReport = [Float](repeating: 0.0, count: 6)
+        floatBank.getFloat16PrecisionReport(&halfReport, samples: &frame, numSamples: Int32(frameLength), hop: 256)
+        floatBank.getBFloat16PrecisionReport(&bfloatReport, samples: &frame, numSamples: Int32(frameLength), hop: 256)
+        XCTAssertLessThan(halfReport[1], 0.01)
+        XCTAssertLessThan(halfReport[2], bfloatReport[2])
+        XCTAssertLessThan(halfReport[4], 0.05)
+        XCTAssertEqual(floatBank.coefficientPrecisionName(), "Float32")
+    }
 }
@@ -0,0 +1,220 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+import XCTest
+@testable import Oscillators
+@testable import OscillatorsCpp
+
+final class ResonatorBankVecDoubleCppTests: XCTestCase {
+    func testConstructor() throws {
+        var frequencies = FrequenciesFixtures.frequencies.map { Double($0) }
+        var alphas = [Double](repeating: Double(DynamicsFixtures.defaultAlpha), count: frequencies.count)
+        let resonatorBankCpp = ResonatorBankVecDoubleCpp(numResonators: Int32(frequencies.count),
+                                                         frequencies: &frequencies,
+                                                         alphas: &alphas,
+                                                         betas: &alphas,
+                                                         sampleRate: Double(AudioFixtures.defaultSampleRate))
+        guard let resonatorBankCpp = resonatorBankCpp else { return XCTAssert(false) }
+
+        XCTAssertEqual(Int(resonatorBankCpp.numResonators()), frequencies.count)
+        for index in 0..<resonatorBankCpp.numResonators() {
+            XCTAssertEqual(resonatorBankCpp.frequencyValue(index), frequencies[Int(index)])
+            XCTAssertEqual(resonatorBankCpp.alphaValue(index), Double(DynamicsFixtures.defaultAlpha))
+        }
+    }
+
+    func testUpdate() throws {
+        var frequencies = FrequenciesFixtures.frequencies.map { Double($0) }
+        var alphas = [Double](repeating: Double(DynamicsFixtures.defaultAlpha), count: frequencies.count)
+        let sampleRate = Double(AudioFixtures.defaultSampleRate)
+        let resonatorBank = ResonatorBankDoubleCpp(numResonators: Int32(frequencies.count),
+                                                   frequencies: &frequencies,
+                                                   alphas: &alphas,
+                                                   betas: &alphas,
+                                                   sampleRate: sampleRate)
+        let vecBank = ResonatorBankVecDoubleCpp(numResonators: Int32(frequencies.count),
+                                                frequencies: &frequencies,
+                                                alphas: &alphas,
+                                                betas: &alphas,
+                                                sampleRate: sampleRate)
+        guard let resonatorBank = resonatorBank, let vecBank = vecBank else { return XCTAssert(false) }
+
+        let frameLength = 4410
+        var frame = [Double](repeating: 0.0, count: frameLength)
+        for index in 0..<frameLength {
+            frame[index] = 0.5 * sin(2.0 * Double.pi * 440.0 * Double(index) / sampleRate)
+        }
+        resonatorBank.update(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+        vecBank.update(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+
+        // same results as the double precision ResonatorBank, within double rounding
+        let size = frequencies.count
+        var powers = [Double](repeating: 0.0, count: size)
+        var vecPowers = [Double](repeating: 0.0, count: size)
+        resonatorBank.getPowers(&powers, size: Int32(size))
+        vecBank.getPowers(&vecPowers, size: Int32(size))
+        let maxPower = powers.max() ?? 0.0
+        for index in 0..<size {
+            XCTAssertEqual(vecPowers[index], powers[index], accuracy: 1e-9 * maxPower)
+        }
+    }
+
+    func testUpdateParallel() throws {
+        var freqs = [110.0, 440.0, 1000.0, 5512.5]
+        var alphas = [Double](repeating: Double(DynamicsFixtures.defaultAlpha), count: freqs.count)
+        let sampleRate = Double(AudioFixtures.defaultSampleRate)
+        func makeBank() -> ResonatorBankVecDoubleCpp? {
+            return ResonatorBankVecDoubleCpp(numResonators: Int32(freqs.count), frequencies: &freqs, alphas: &alphas, betas: &alphas,
+                                             sampleRate: sampleRate)
+        }
+        guard let sequentialBank = makeBank(), let parallelBank = makeBank() else { return XCTAssert(false) }
+        parallelBank.setNumThreads(4)
+
+        let tolerance = 0.0001
+        let warmUpLength = Int(parallelBank.warmUpLength(tolerance: tolerance))
+        XCTAssertGreaterThan(warmUpLength, 0)
+
+        // long enough for 4 segments
+        let length = 8 * warmUpLength + 1000
+        let outputInterval = 64
+        var signal = [Double](repeating: 0.0, count: length)
+        for index in 0..<length {
+            signal[index] = 0.5 * sin(2.0 * Double.pi * 440.0 * Double(index) / sampleRate)
+        }
+        let size = freqs.count
+        let numRows = length / outputInterval
+        var sequentialAmplitudes = [Double](repeating: 0.0, count: numRows * size)
+        var parallelAmplitudes = [Double](repeating: 0.0, count: numRows * size)
+        XCTAssertEqual(Int(sequentialBank.update(frameData: &signal, frameLength: Int32(length), sampleStride: 1,
+                                                 outputInterval: Int32(outputInterval), powers: nil, amplitudes: &sequentialAmplitudes)), numRows)
+        XCTAssertEqual(Int(parallelBank.updateParallel(data: &signal, length: Int32(length), sampleStride: 1,
+                                                       outputInterval: Int32(outputInterval), powers: nil, amplitudes: &parallelAmplitudes,
+                                                       tolerance: tolerance)), numRows)
+        // within tolerance of the signal amplitude (no float rounding to allow for)
+        for index in 0..<(numRows * size) {
+            XCTAssertEqual(parallelAmplitudes[index], sequentialAmplitudes[index], accuracy: tolerance)
+        }
+    }
+
+    func testLowFrequencyTracking() throws {
+        // 0.5 Hz at 192 kHz: see ResonatorBankDoubleCppTests.testLowFrequencyTuning
+        let sampleRate = 192000.0
+        var frequencies = [0.5]
+        var alphas = [0.0001]
+        var floatFrequencies = frequencies.map { Float($0) }
+        var floatAlphas = alphas.map { Float($0) }
+        let doubleBank = ResonatorBankVecDoubleCpp(numResonators: 1, frequencies: &frequencies, alphas: &alphas, betas: &alphas,
+                                                   sampleRate: sampleRate)
+        let floatBank = ResonatorBankVecCpp(numResonators: 1, frequencies: &floatFrequencies, alphas: &floatAlphas, betas: &floatAlphas,
+                                            sampleRate: Float(sampleRate))
+        guard let doubleBank = doubleBank, let floatBank = floatBank else { return XCTAssert(false) }
+
+        let frameLength = 19200
+        var frame = [Double](repeating: 0.0, count: frameLength)
+        var floatFrame = [Float](repeating: 0.0, count: frameLength)
+        var trackedFrequency = [0.0]
+        var floatTrackedFrequency: [Float] = [0.0]
+        var phases = [Double]()
+        var floatPhases = [Float]()
+        for frameIndex in 0..<100 {
+            for index in 0..<frameLength {
+                frame[index] = sin(2.0 * Double.pi * frequencies[0] * Double(frameIndex * frameLength + index) / sampleRate)
+                floatFrame[index] = Float(frame[index])
+            }
+            doubleBank.updateAndTrack(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1,
+                                      trackedFrequencies: &trackedFrequency)
+            floatBank.updateAndTrack(frameData: &floatFrame, frameLength: Int32(frameLength), sampleStride: 1,
+                                     trackedFrequencies: &floatTrackedFrequency)
+            phases.append(doubleBank.phaseValue(0))
+            floatPhases.append(floatBank.phaseValue(0))
+        }
+        // settled after 5 s
+        let drift = abs(phases[99] - phases[49])
+        let floatDrift = abs(Double(floatPhases[99] - floatPhases[49]))
+        XCTAssertLessThan(drift, 1e-6)
+        XCTAssertGreaterThan(floatDrift, drift)
+    }
+
+    func testReducedPrecisionCoefficients() throws {
+        var frequencies = FrequenciesFixtures.frequencies.map { Double($0) }
+        var alphas = [Double](repeating: Double(DynamicsFixtures.defaultAlpha), count: frequencies.count)
+        let sampleRate = Double(AudioFixtures.defaultSampleRate)
+        func makeBank() -> ResonatorBankVecDoubleCpp? {
+            return ResonatorBankVecDoubleCpp(numResonators: Int32(frequencies.count), frequencies: &frequencies, alphas: &alphas, betas: &alphas,
+                                             sampleRate: sampleRate)
+        }
+        guard let doubleBank = makeBank(), let halfBank = makeBank() else { return XCTAssert(false) }
+        XCTAssertEqual(doubleBank.coefficientPrecisionName(), "Float32")
+        halfBank.setFloat16Coefficients()
+        XCTAssertEqual(halfBank.coefficientPrecisionName(), "Float16")
+
+        let frameLength = Int(sampleRate)
+        var frame = [Double](repeating: 0.0, count: frameLength)
+        for index in 0..<frameLength {
+            frame[index] = 0.5 * sin(2.0 * Double.pi * 440.0 * Double(index) / sampleRate)
+        }
+        doubleBank.update(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+        halfBank.update(frameData: &frame, frameLength: Int32(frameLength), sampleStride: 1)
+
+        // same detuning as in float (see ResonatorBankVecCppTests.testReducedPrecisionCoefficients)
+        let size = frequencies.count
+        var powers = [Double](repeating: 0.0, count: size)
+        var halfPowers = [Double](repeating: 0.0, count: size)
+        doubleBank.getPowers(&powers, size: Int32(size))
+        halfBank.getPowers(&halfPowers, size: Int32(size))
+        let maxPower = powers.max() ?? 0.0
+        for index in 0..<size {
+            XCTAssertEqual(halfPowers[index], powers[index], accuracy: 0.05 * maxPower)
+        }
+    }
+
+    func testCheckpoint() throws {
+        var frequencies = [110.0, 440.0, 1000.0]
+        var alphas = [Double](repeating: Double(DynamicsFixtures.defaultAlpha), count: frequencies.count)
+        // a sample rate that float cannot represent, restored exactly
+        let sampleRate = 44100.1
+        let bank = ResonatorBankVecDoubleCpp(numResonators: Int32(frequencies.count), frequencies: &frequencies, alphas: &alphas, betas: &alphas,
+                                             sampleRate: sampleRate)
+        guard let bank = bank else { return XCTAssert(false) }
+
+        var frame = [Double](repeating: 0.0, count: 1000)
+        for index in 0..<frame.count {
+            frame[index] = 0.5 * sin(2.0 * Double.pi * 440.0 * Double(index) / sampleRate)
+        }
+        bank.update(frameData: &frame, frameLength: Int32(frame.count), sampleStride: 1)
+        var checkpoint = [UInt8](repeating: 0, count: Int(bank.checkpointSize()))
+        XCTAssertEqual(bank.saveCheckpoint(data: &checkpoint, size: Int32(checkpoint.count)), bank.checkpointSize())
+        guard let restoredBank = ResonatorBankVecDoubleCpp(checkpoint: &checkpoint, size: Int32(checkpoint.count)) else { return XCTAssert(false) }
+        XCTAssertEqual(restoredBank.sampleRate(), sampleRate)
+
+        // both banks continue identically
+        bank.update(frameData: &frame, frameLength: Int32(frame.count), sampleStride: 1)
+        restoredBank.update(frameData: &frame, frameLength: Int32(frame.count), sampleStride: 1)
+        var powers = [Double](repeating: 0.0, count: frequencies.count)
+        var restoredPowers = [Double](repeating: 0.0, count: frequencies.count)
+        bank.getPowers(&powers, size: Int32(frequencies.count))
+        restoredBank.getPowers(&restoredPowers, size: Int32(frequencies.count))
+        XCTAssertEqual(powers, restoredPowers)
+    }
+}
@@ -86,4 +86,26 @@ final class ResonatorCppTests: XCTestCase {
     }
     
     // Suggestion: test frequency tracking and phase?
+
+    func testCheckpoint() throws {
+        let resonator = ResonatorCpp(frequency: 440.0, alpha: 0.01, beta: 0.01, sampleRate: AudioFixtures.defaultSampleRate)
+        let restored = ResonatorCpp(frequency: 110.0, alpha: 0.5, beta: 0.5, sampleRate: AudioFixtures.defaultSampleRate)
+        guard let resonator = resonator, let restored = restored else { return XCTAssert(false, "ResonatorCpp could not be instantiated") }
+        var frame = [Float](repeating: 0.0, count: 1024)
+        for index in 0..<frame.count {
+            frame[index] = 0.5 * sin(2.0 * Float.pi * 440.0 * Float(index) / AudioFixtures.defaultSampleRate)
+        }
+        resonator.update(frameData: &frame, frameLength: Int32(frame.count), sampleStride: 1)
+
+        var checkpoint = [UInt8](repeating: 0, count: Int(resonator.checkpointSize()))
+        XCTAssertEqual(resonator.saveCheckpoint(data: &checkpoint, size: Int32(checkpoint.count)), resonator.checkpointSize())
+        restored.restoreCheckpoint(data: &checkpoint, size: Int32(checkpoint.count))
+        XCTAssertEqual(restored.frequency(), 440.0)
+        XCTAssertEqual(restored.alpha(), 0.01)
+
+        resonator.update(frameData: &frame, frameLength: Int32(frame.count), sampleStride: 1)
+        restored.update(frameData: &frame, frameLength: Int32(frame.count), sampleStride: 1)
+        XCTAssertEqual(restored.cc(), resonator.cc())
+        XCTAssertEqual(restored.ss(), resonator.ss())
+    }
 }
@@ -0,0 +1,148 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+import XCTest
+@testable import Oscillators
+@testable import OscillatorsCpp
+
+final class SpectrogramCppTests: XCTestCase {
+    func makeFrames(numFrames: Int, hop: Int, frequencies: inout [Float], alphas: inout [Float]) -> [Float] {
+        let resonatorBankVecCpp = ResonatorBankVecCpp(numResonators: Int32(frequencies.count),
+                                                      frequencies: &frequencies,
+                                                      alphas: &alphas,
+                                                      betas: &alphas,
+                                                      sampleRate: AudioFixtures.defaultSampleRate)
+        guard let resonatorBankVecCpp = resonatorBankVecCpp else { return [] }
+        var frames = [Float](repeating: 0.0, count: numFrames * frequencies.count)
+        var samples = [Float](repeating: 0.0, count: hop)
+        for frame in 0..<numFrames {
+            for index in 0..<hop {
+                samples[index] = 0.5 * sin(2.0 * Float.pi * 440.0 * Float(frame * hop + index) / AudioFixtures.defaultSampleRate)
+            }
+            resonatorBankVecCpp.update(frameData: &samples, frameLength: Int32(hop), sampleStride: 1)
+            frames.withUnsafeMutableBufferPointer { rows in
+                resonatorBankVecCpp.getPowers(rows.baseAddress! + frame * frequencies.count, size: Int32(frequencies.count))
+            }
+        }
+        return frames
+    }
+
+    func testFloat16() throws {
+        var frequencies = FrequenciesFixtures.frequencies
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: frequencies.count)
+        let numResonators = frequencies.count
+        let numFrames = 300
+        let frames = makeFrames(numFrames: numFrames, hop: 256, frequencies: &frequencies, alphas: &alphas)
+        let path = NSTemporaryDirectory() + "SpectrogramCppTests.float16.spg"
+        defer { try? FileManager.default.removeItem(atPath: path) }
+
+        let writer = SpectrogramWriterCpp(path: path,
+                                          numResonators: Int32(numResonators),
+                                          frequencies: &frequencies,
+                                          alphas: &alphas,
+                                          betas: &alphas,
+                                          sampleRate: AudioFixtures.defaultSampleRate,
+                                          hop: 256,
+                                          framesPerChunk: 64)
+        guard let writer = writer else { return XCTAssert(false) }
+        // appended in uneven pieces, as from an update loop
+        var first = 0
+        while first < numFrames {
+            let count = min(numFrames - first, 1 + first % 7)
+            frames.withUnsafeBufferPointer { rows in
+                writer.append(frames: rows.baseAddress! + first * numResonators, numFrames: Int32(count))
+            }
+            first += count
+        }
+        writer.close()
+        XCTAssertEqual(Int(writer.numFrames()), numFrames)
+
+        let reader = SpectrogramReaderCpp(path: path)
+        guard let reader = reader else { return XCTAssert(false) }
+        XCTAssertEqual(Int(reader.numResonators()), numResonators)
+        XCTAssertEqual(Int(reader.numFrames()), numFrames)
+        XCTAssertEqual(reader.numChunks(), 5)
+        XCTAssertEqual(reader.sampleRate(), AudioFixtures.defaultSampleRate)
+        XCTAssertEqual(reader.hop(), 256)
+        var readFrequencies = [Float](repeating: 0.0, count: numResonators)
+        reader.getFrequencies(&readFrequencies, size: Int32(numResonators))
+        XCTAssertEqual(readFrequencies, frequencies)
+
+        // a range across chunks
+        let rangeFirst = 50
+        let rangeCount = 100
+        var range = [Float](repeating: 0.0, count: rangeCount * numResonators)
+        reader.readFrames(&range, first: Int32(rangeFirst), count: Int32(rangeCount))
+        let chunkMax = frames.max()!
+        for index in 0..<range.count {
+            let value = frames[rangeFirst * numResonators + index]
+            XCTAssertEqual(range[index], value, accuracy: max(value / 1024.0, chunkMax * 1e-8))
+        }
+    }
+
+    func testLog8() throws {
+        var frequencies = FrequenciesFixtures.frequencies
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: frequencies.count)
+        let numResonators = frequencies.count
+        let numFrames = 100
+        let frames = makeFrames(numFrames: numFrames, hop: 256, frequencies: &frequencies, alphas: &alphas)
+        let path = NSTemporaryDirectory() + "SpectrogramCppTests.log8.spg"
+        defer { try? FileManager.default.removeItem(atPath: path) }
+
+        let writer = SpectrogramWriterCpp(log8WithPath: path,
+                                          numResonators: Int32(numResonators),
+                                          frequencies: &frequencies,
+                                          alphas: &alphas,
+                                          betas: &alphas,
+                                          sampleRate: AudioFixtures.defaultSampleRate,
+                                          hop: 256,
+                                          framesPerChunk: numFrames,
+                                          dynamicRange: 60.0)
+        guard let writer = writer else { return XCTAssert(false) }
+        frames.withUnsafeBufferPointer { rows in
+            writer.append(frames: rows.baseAddress!, numFrames: Int32(numFrames / 2))
+        }
+        // flushed frames are visible to readers before the writer is closed
+        writer.flush()
+        let liveReader = SpectrogramReaderCpp(path: path)
+        XCTAssertEqual(liveReader?.numFrames(), Int32(numFrames / 2))
+        frames.withUnsafeBufferPointer { rows in
+            writer.append(frames: rows.baseAddress! + numFrames / 2 * numResonators, numFrames: Int32(numFrames - numFrames / 2))
+        }
+        writer.close()
+
+        let reader = SpectrogramReaderCpp(path: path)
+        guard let reader = reader else { return XCTAssert(false) }
+        XCTAssertEqual(Int(reader.numFrames()), numFrames)
+        XCTAssertEqual(reader.numChunks(), 2)
+        var decoded = [Float](repeating: 0.0, count: numFrames * numResonators)
+        reader.readFrames(&decoded, first: 0, count: Int32(numFrames))
+        // values within half a quantization step (0.12 dB), zero below the dynamic range
+        let maxValue = frames.max()!
+        for index in 0..<frames.count where frames[index] > maxValue * 1e-5 {
+            XCTAssertEqual(decoded[index], frames[index], accuracy: frames[index] * 0.03)
+        }
+    }
+}
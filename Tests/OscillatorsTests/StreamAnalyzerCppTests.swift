@@ -0,0 +1,112 @@
+/**
+MIT License
+
+Copyright (c) 2026 Alexandre R. J. Francois
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+import XCTest
+@testable import Oscillators
+@testable import OscillatorsCpp
+
+final class StreamAnalyzerCppTests: XCTestCase {
+    func testConstructor() throws {
+        var frequencies = FrequenciesFixtures.frequencies
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: frequencies.count)
+        let streamAnalyzerCpp = StreamAnalyzerCpp(numResonators: (Int32)(frequencies.count),
+                                                  frequencies: &frequencies,
+                                                  alphas: &alphas,
+                                                  betas: &alphas,
+                                                  sampleRate: AudioFixtures.defaultSampleRate,
+                                                  hopSize: 256,
+                                                  capacity: 3000)
+        guard let streamAnalyzerCpp = streamAnalyzerCpp else { return XCTAssert(false) }
+        XCTAssertEqual(Int(streamAnalyzerCpp.numResonators()), frequencies.count)
+        XCTAssertEqual(streamAnalyzerCpp.hopSize(), 256)
+        XCTAssertEqual(streamAnalyzerCpp.capacity(), 4096)
+        XCTAssertFalse(streamAnalyzerCpp.running())
+        XCTAssertEqual(streamAnalyzerCpp.queueDepth(), 0)
+    }
+
+    func testPushAndAnalyze() throws {
+        var freqs: [Float] = [110.0, 440.0, 1000.0, 5512.5]
+        var alphas = [Float](repeating: DynamicsFixtures.defaultAlpha, count: freqs.count)
+        let hopSize = 256
+        let numHops = 8
+        let streamAnalyzerCpp = StreamAnalyzerCpp(numResonators: (Int32)(freqs.count),
+                                                  frequencies: &freqs,
+                                                  alphas: &alphas,
+                                                  betas: &alphas,
+                                                  sampleRate: AudioFixtures.defaultSampleRate,
+                                                  hopSize: Int32(hopSize),
+                                                  capacity: Int32(numHops * hopSize))
+        let resonatorBankVecCpp = ResonatorBankVecCpp(numResonators: (Int32)(freqs.count),
+                                                      frequencies: &freqs,
+                                                      alphas: &alphas,
+                                                      betas: &alphas,
+                                                      sampleRate: AudioFixtures.defaultSampleRate)
+        guard let streamAnalyzerCpp = streamAnalyzerCpp, let resonatorBankVecCpp = resonatorBankVecCpp else { return XCTAssert(false) }
+
+        var samples = [Float](repeating: 0.0, count: numHops * hopSize)
+        for index in 0..<samples.count {
+            samples[index] = 0.5 * sin(2.0 * Float.pi * 440.0 * Float(index) / AudioFixtures.defaultSampleRate)
+        }
+
+        // fill the buffer, then overrun
+        XCTAssertEqual(Int(streamAnalyzerCpp.push(frameData: &samples, frameLength: Int32(samples.count), sampleStride: 1)), samples.count)
+        XCTAssertEqual(Int(streamAnalyzerCpp.queueDepth()), samples.count)
+        XCTAssertEqual(streamAnalyzerCpp.push(frameData: &samples, frameLength: 10, sampleStride: 1), 0)
+        XCTAssertEqual(streamAnalyzerCpp.overruns(), 1)
+        XCTAssertEqual(streamAnalyzerCpp.droppedSamples(), 10)
+
+        // drain the buffer
+        streamAnalyzerCpp.start()
+        XCTAssertTrue(streamAnalyzerCpp.running())
+        let deadline = Date().addingTimeInterval(10.0)
+        while Int(streamAnalyzerCpp.hopsProcessed()) < numHops && Date() < deadline {
+            Thread.sleep(forTimeInterval: 0.001)
+        }
+        streamAnalyzerCpp.stop()
+        XCTAssertEqual(Int(streamAnalyzerCpp.hopsProcessed()), numHops)
+        XCTAssertEqual(streamAnalyzerCpp.queueDepth(), 0)
+
+        // same values as running the bank hop by hop
+        for hop in 0..<numHops {
+            var frame = Array(samples[hop * hopSize..<(hop + 1) * hopSize])
+            resonatorBankVecCpp.update(frameData: &frame, frameLength: Int32(hopSize), sampleStride: 1)
+        }
+        let size = Int(streamAnalyzerCpp.numResonators())
+        var streamPowers = [Float](repeating: 0.0, count: size)
+        var bankPowers = [Float](repeating: 0.0, count: size)
+        streamAnalyzerCpp.getPowers(&streamPowers, size: Int32(size))
+        resonatorBankVecCpp.getPowers(&bankPowers, size: Int32(size))
+        for k in 0..<size {
+            XCTAssertEqual(streamPowers[k], bankPowers[k])
+        }
+
+        // the last hop was published
+        var snapshotPowers = [Float](repeating: 0.0, count: size)
+        XCTAssertEqual(Int(streamAnalyzerCpp.getSnapshot(powers: &snapshotPowers, amplitudes: nil, phases: nil, size: Int32(size))), numHops)
+        for k in 0..<size {
+            XCTAssertEqual(snapshotPowers[k], bankPowers[k])
+        }
+    }
+}